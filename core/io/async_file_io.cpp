@@ -0,0 +1,277 @@
+/*************************************************************************/
+/*  async_file_io.cpp                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "async_file_io.h"
+
+#include "core/object/message_queue.h"
+#include "core/os/file_access.h"
+
+void AsyncFileRequest::_process() {
+	if (operation == OPERATION_READ) {
+		FileAccess *f = FileAccess::open(path, FileAccess::READ, &error);
+		if (f) {
+			uint64_t len = f->get_len();
+			uint64_t to_read = offset < len ? len - offset : 0;
+			if (length >= 0 && (uint64_t)length < to_read) {
+				to_read = length;
+			}
+			if (to_read > (uint64_t)INT32_MAX) {
+				// Vector and FileAccess::get_buffer() sizes are int, larger reads must be split by the caller.
+				error = ERR_OUT_OF_MEMORY;
+				to_read = 0;
+			}
+
+			data.resize(to_read);
+			if (to_read) {
+				f->seek(offset);
+				int64_t read = f->get_buffer(data.ptrw(), to_read);
+				if (read < (int64_t)to_read) {
+					data.resize(MAX(read, 0));
+					error = ERR_FILE_EOF;
+				}
+			}
+
+			f->close();
+			memdelete(f);
+		}
+	} else {
+		FileAccess *f = nullptr;
+		if (append && FileAccess::exists(path)) {
+			f = FileAccess::open(path, FileAccess::READ_WRITE, &error);
+			if (f) {
+				f->seek_end();
+			}
+		} else {
+			f = FileAccess::open(path, FileAccess::WRITE, &error);
+		}
+
+		if (f) {
+			f->store_buffer(data.ptr(), data.size());
+			error = f->get_error();
+			f->close();
+			memdelete(f);
+		}
+		data.clear();
+	}
+
+	completed.set();
+	done.post();
+
+	if (completion_func) {
+		completion_func(completion_userdata, this);
+	}
+}
+
+String AsyncFileRequest::get_path() const {
+	return path;
+}
+
+bool AsyncFileRequest::is_completed() const {
+	return completed.is_set();
+}
+
+Error AsyncFileRequest::get_error() const {
+	ERR_FAIL_COND_V_MSG(!completed.is_set(), ERR_BUSY, "The request for '" + path + "' isn't completed yet.");
+	return error;
+}
+
+Vector<uint8_t> AsyncFileRequest::get_data() const {
+	ERR_FAIL_COND_V_MSG(!completed.is_set(), Vector<uint8_t>(), "The request for '" + path + "' isn't completed yet.");
+	return data;
+}
+
+Error AsyncFileRequest::wait() {
+	if (!completed.is_set()) {
+		done.wait();
+		done.post(); // Let other threads waiting for it through too.
+	}
+	return error;
+}
+
+void AsyncFileRequest::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("get_path"), &AsyncFileRequest::get_path);
+	ClassDB::bind_method(D_METHOD("is_completed"), &AsyncFileRequest::is_completed);
+	ClassDB::bind_method(D_METHOD("get_error"), &AsyncFileRequest::get_error);
+	ClassDB::bind_method(D_METHOD("get_data"), &AsyncFileRequest::get_data);
+	ClassDB::bind_method(D_METHOD("wait"), &AsyncFileRequest::wait);
+
+	ADD_SIGNAL(MethodInfo("completed"));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+AsyncFileIO *AsyncFileIO::singleton = nullptr;
+
+void AsyncFileIO::_worker(void *p_userdata) {
+	AsyncFileIO *io = (AsyncFileIO *)p_userdata;
+
+	while (true) {
+		io->semaphore.wait();
+
+		io->mutex.lock();
+		if (io->queue.is_empty()) {
+			// Pending requests are done before exiting, so writes aren't lost.
+			bool done = io->exit;
+			io->mutex.unlock();
+			if (done) {
+				return;
+			}
+			continue;
+		}
+		Ref<AsyncFileRequest> request = io->queue.front()->get();
+		io->queue.pop_front();
+		io->mutex.unlock();
+
+		request->_process();
+		io->_request_completed(request);
+	}
+}
+
+void AsyncFileIO::_request_completed(const Ref<AsyncFileRequest> &p_request) {
+	if (!MessageQueue::get_singleton()) {
+		return;
+	}
+
+	// Requests are kept alive until "completed" is emitted, even when the caller dropped its reference.
+	MutexLock lock(mutex);
+	completed.push_back(p_request);
+	if (!emit_queued) {
+		emit_queued = true;
+		MessageQueue::get_singleton()->push_callable(callable_mp(this, &AsyncFileIO::_emit_completed));
+	}
+}
+
+void AsyncFileIO::_emit_completed() {
+	List<Ref<AsyncFileRequest>> to_emit;
+	{
+		MutexLock lock(mutex);
+		SWAP(to_emit, completed);
+		emit_queued = false;
+	}
+
+	for (List<Ref<AsyncFileRequest>>::Element *E = to_emit.front(); E; E = E->next()) {
+		E->get()->emit_signal("completed");
+	}
+}
+
+void AsyncFileIO::_enqueue(Ref<AsyncFileRequest> &p_request) {
+	MutexLock lock(mutex);
+	if (exit) {
+		p_request->error = ERR_UNAVAILABLE;
+		p_request->completed.set();
+		p_request->done.post();
+		ERR_FAIL_MSG("Can't start file requests after AsyncFileIO has finished.");
+	}
+
+	queue.push_back(p_request);
+
+	// Workers start as needed, I/O bound so more than the processor count could help, but not by much.
+	if (workers.size() < MIN((uint32_t)MAX_WORKERS, (uint32_t)queue.size())) {
+		Thread *worker = memnew(Thread);
+		worker->start(_worker, this);
+		workers.push_back(worker);
+	}
+
+	semaphore.post();
+}
+
+Ref<AsyncFileRequest> AsyncFileIO::read(const String &p_path, uint64_t p_offset, int64_t p_length, AsyncFileRequest::CompletionFunc p_func, void *p_userdata) {
+	Ref<AsyncFileRequest> request;
+	request.instance();
+	request->operation = AsyncFileRequest::OPERATION_READ;
+	request->path = p_path;
+	request->offset = p_offset;
+	request->length = p_length;
+	request->completion_func = p_func;
+	request->completion_userdata = p_userdata;
+
+	_enqueue(request);
+	return request;
+}
+
+Ref<AsyncFileRequest> AsyncFileIO::write(const String &p_path, const Vector<uint8_t> &p_data, bool p_append, AsyncFileRequest::CompletionFunc p_func, void *p_userdata) {
+	Ref<AsyncFileRequest> request;
+	request.instance();
+	request->operation = AsyncFileRequest::OPERATION_WRITE;
+	request->path = p_path;
+	request->data = p_data;
+	request->append = p_append;
+	request->completion_func = p_func;
+	request->completion_userdata = p_userdata;
+
+	_enqueue(request);
+	return request;
+}
+
+Ref<AsyncFileRequest> AsyncFileIO::_read_bind(const String &p_path, uint64_t p_offset, int64_t p_length) {
+	return read(p_path, p_offset, p_length);
+}
+
+Ref<AsyncFileRequest> AsyncFileIO::_write_bind(const String &p_path, const Vector<uint8_t> &p_data, bool p_append) {
+	return write(p_path, p_data, p_append);
+}
+
+int AsyncFileIO::get_pending_count() {
+	MutexLock lock(mutex);
+	return queue.size();
+}
+
+void AsyncFileIO::finish() {
+	mutex.lock();
+	exit = true;
+	mutex.unlock();
+
+	for (uint32_t i = 0; i < workers.size(); i++) {
+		semaphore.post();
+	}
+	for (uint32_t i = 0; i < workers.size(); i++) {
+		workers[i]->wait_to_finish();
+		memdelete(workers[i]);
+	}
+	workers.clear();
+
+	MutexLock lock(mutex);
+	completed.clear();
+}
+
+void AsyncFileIO::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("read", "path", "offset", "length"), &AsyncFileIO::_read_bind, DEFVAL(0), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("write", "path", "data", "append"), &AsyncFileIO::_write_bind, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_pending_count"), &AsyncFileIO::get_pending_count);
+}
+
+AsyncFileIO::AsyncFileIO() {
+	singleton = this;
+}
+
+AsyncFileIO::~AsyncFileIO() {
+	finish();
+	singleton = nullptr;
+}
@@ -0,0 +1,132 @@
+/*************************************************************************/
+/*  async_file_io.h                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef ASYNC_FILE_IO_H
+#define ASYNC_FILE_IO_H
+
+#include "core/object/class_db.h"
+#include "core/object/reference.h"
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/templates/list.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+// A read or write done by AsyncFileIO. Can be waited for, and emits "completed" on the main thread when done.
+class AsyncFileRequest : public Reference {
+	GDCLASS(AsyncFileRequest, Reference);
+
+public:
+	// Called from the thread that did the operation, before "completed" is emitted.
+	typedef void (*CompletionFunc)(void *p_userdata, AsyncFileRequest *p_request);
+
+private:
+	friend class AsyncFileIO;
+
+	enum Operation {
+		OPERATION_READ,
+		OPERATION_WRITE,
+	};
+
+	Operation operation = OPERATION_READ;
+	String path;
+	uint64_t offset = 0;
+	int64_t length = -1;
+	bool append = false;
+	Vector<uint8_t> data;
+
+	Error error = OK;
+	SafeFlag completed;
+	Semaphore done;
+
+	CompletionFunc completion_func = nullptr;
+	void *completion_userdata = nullptr;
+
+	void _process();
+
+protected:
+	static void _bind_methods();
+
+public:
+	String get_path() const;
+	bool is_completed() const;
+	Error get_error() const;
+	Vector<uint8_t> get_data() const;
+
+	Error wait();
+
+	AsyncFileRequest() {}
+};
+
+// Reads and writes files on worker threads, so the calling thread doesn't block on I/O.
+class AsyncFileIO : public Object {
+	GDCLASS(AsyncFileIO, Object);
+
+	enum {
+		MAX_WORKERS = 4,
+	};
+
+	static AsyncFileIO *singleton;
+
+	Mutex mutex;
+	Semaphore semaphore;
+	List<Ref<AsyncFileRequest>> queue;
+	List<Ref<AsyncFileRequest>> completed; // Waiting for "completed" to be emitted on the main thread.
+	bool emit_queued = false;
+	LocalVector<Thread *> workers;
+	bool exit = false;
+
+	static void _worker(void *p_userdata);
+	void _enqueue(Ref<AsyncFileRequest> &p_request);
+	void _request_completed(const Ref<AsyncFileRequest> &p_request);
+	void _emit_completed();
+
+	Ref<AsyncFileRequest> _read_bind(const String &p_path, uint64_t p_offset, int64_t p_length);
+	Ref<AsyncFileRequest> _write_bind(const String &p_path, const Vector<uint8_t> &p_data, bool p_append);
+
+protected:
+	static void _bind_methods();
+
+public:
+	static AsyncFileIO *get_singleton() { return singleton; }
+
+	Ref<AsyncFileRequest> read(const String &p_path, uint64_t p_offset = 0, int64_t p_length = -1, AsyncFileRequest::CompletionFunc p_func = nullptr, void *p_userdata = nullptr);
+	Ref<AsyncFileRequest> write(const String &p_path, const Vector<uint8_t> &p_data, bool p_append = false, AsyncFileRequest::CompletionFunc p_func = nullptr, void *p_userdata = nullptr);
+
+	int get_pending_count();
+
+	void finish();
+
+	AsyncFileIO();
+	~AsyncFileIO();
+};
+
+#endif // ASYNC_FILE_IO_H
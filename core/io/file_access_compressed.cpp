@@ -30,7 +30,10 @@
 
 #include "file_access_compressed.h"
 
+#include "core/io/marshalls.h"
+#include "core/os/os.h"
 #include "core/string/print_string.h"
+#include "core/templates/thread_work_pool.h"
 
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, int p_block_size) {
 	magic = p_magic.ascii().get_data();
@@ -58,6 +61,37 @@ void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_
 		}                                                   \
 	}
 
+Vector<uint8_t> FileAccessCompressed::compress_buffer(const uint8_t *p_src, uint32_t p_len, const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
+	ERR_FAIL_COND_V(p_block_size == 0, Vector<uint8_t>());
+	CharString mgc = p_magic.utf8();
+	ERR_FAIL_COND_V(mgc.length() != 4, Vector<uint8_t>());
+
+	int bc = (p_len / p_block_size) + 1;
+	int header_size = 16 + bc * 4;
+
+	Vector<uint8_t> out;
+	out.resize(header_size + Compression::get_max_compressed_buffer_size(p_block_size, p_mode) * bc + 4);
+	uint8_t *w = out.ptrw();
+
+	memcpy(w, mgc.get_data(), 4); //write header 4
+	encode_uint32(p_mode, &w[4]); //write compression mode 4
+	encode_uint32(p_block_size, &w[8]); //write block size 4
+	encode_uint32(p_len, &w[12]); //max amount of data written 4
+
+	int ofs = header_size;
+	for (int i = 0; i < bc; i++) {
+		int bl = i == (bc - 1) ? p_len % p_block_size : p_block_size;
+		int s = Compression::compress(&w[ofs], &p_src[i * p_block_size], bl, p_mode);
+		encode_uint32(s, &w[16 + i * 4]); //compressed size of the block
+		ofs += s;
+	}
+
+	memcpy(&w[ofs], mgc.get_data(), 4); //magic at the end too
+	out.resize(ofs + 4);
+
+	return out;
+}
+
 Error FileAccessCompressed::open_after_magic(FileAccess *p_base) {
 	f = p_base;
 	cmode = (Compression::Mode)f->get_32();
@@ -142,37 +176,8 @@ void FileAccessCompressed::close() {
 
 	if (writing) {
 		//save block table and all compressed blocks
-
-		CharString mgc = magic.utf8();
-		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //write header 4
-		f->store_32(cmode); //write compression mode 4
-		f->store_32(block_size); //write block size 4
-		f->store_32(write_max); //max amount of data written 4
-		int bc = (write_max / block_size) + 1;
-
-		for (int i = 0; i < bc; i++) {
-			f->store_32(0); //compressed sizes, will update later
-		}
-
-		Vector<int> block_sizes;
-		for (int i = 0; i < bc; i++) {
-			int bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
-
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
-
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
-		}
-
-		f->seek(16); //ok write block sizes
-		for (int i = 0; i < bc; i++) {
-			f->store_32(block_sizes[i]);
-		}
-		f->seek_end();
-		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
+		Vector<uint8_t> data = compress_buffer(write_ptr, write_max, magic, cmode, block_size);
+		f->store_buffer(data.ptr(), data.size());
 
 		buffer.clear();
 
@@ -296,31 +301,92 @@ int FileAccessCompressed::get_buffer(uint8_t *p_dst, int p_length) const {
 		return 0;
 	}
 
-	for (int i = 0; i < p_length; i++) {
-		p_dst[i] = read_ptr[read_pos];
-		read_pos++;
+	int read = 0;
+	while (read < p_length) {
 		if (read_pos >= read_block_size) {
-			read_block++;
-
-			if (read_block < read_block_count) {
-				//read another block of compressed data
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
-				read_pos = 0;
-
-			} else {
-				read_block--;
+			int next = read_block + 1;
+			if (next >= read_block_count || _get_block_len(next) == 0) {
 				at_end = true;
-				if (i < p_length - 1) {
-					read_eof = true;
-				}
-				return i;
+				read_eof = true;
+				return read;
+			}
+
+			// Blocks entirely covered by the rest of the read are decompressed straight
+			// into the destination, except the last one, which is kept in the buffer.
+			int covered = 0;
+			while (next + covered < read_block_count && int64_t(covered + 1) * block_size <= p_length - read) {
+				covered++;
+			}
+			if (covered > 1) {
+				_decompress_blocks(next, covered - 1, &p_dst[read]);
+				read += (covered - 1) * block_size;
+				next += covered - 1;
 			}
+
+			_load_block(next);
+			continue;
 		}
+
+		int to_copy = MIN(read_block_size - read_pos, p_length - read);
+		memcpy(&p_dst[read], &read_ptr[read_pos], to_copy);
+		read_pos += to_copy;
+		read += to_copy;
+	}
+
+	if (read_pos >= read_block_size && (read_block + 1 >= read_block_count || _get_block_len(read_block + 1) == 0)) {
+		at_end = true;
 	}
 
-	return p_length;
+	return read;
+}
+
+int FileAccessCompressed::_get_block_len(int p_block) const {
+	return p_block == read_block_count - 1 ? read_total % block_size : block_size;
+}
+
+void FileAccessCompressed::_load_block(int p_block) const {
+	f->seek(read_blocks[p_block].offset);
+	f->get_buffer(comp_buffer.ptrw(), read_blocks[p_block].csize);
+	Compression::decompress(buffer.ptrw(), block_size, comp_buffer.ptr(), read_blocks[p_block].csize, cmode);
+	read_block = p_block;
+	read_block_size = _get_block_len(p_block);
+	read_pos = 0;
+}
+
+void FileAccessCompressed::BlockDecompressJob::decompress_block(uint32_t p_index, void *p_userdata) {
+	const ReadBlock &rb = blocks[p_index];
+	Compression::decompress(&dst[p_index * block_size], block_size, &src[rb.offset - src_offset], rb.csize, mode);
+}
+
+void FileAccessCompressed::_decompress_blocks(int p_from, int p_count, uint8_t *p_dst) const {
+	// Compressed blocks are stored back to back, so they can be read in one go.
+	int src_offset = read_blocks[p_from].offset;
+	int src_size = read_blocks[p_from + p_count - 1].offset + read_blocks[p_from + p_count - 1].csize - src_offset;
+
+	Vector<uint8_t> src;
+	src.resize(src_size);
+	f->seek(src_offset);
+	f->get_buffer(src.ptrw(), src_size);
+
+	BlockDecompressJob job;
+	job.src = src.ptr();
+	job.blocks = &read_blocks[p_from];
+	job.dst = p_dst;
+	job.src_offset = src_offset;
+	job.block_size = block_size;
+	job.mode = cmode;
+
+	int thread_count = MIN(p_count, OS::get_singleton()->get_processor_count());
+	if (thread_count > 1 && int64_t(p_count) * block_size >= PARALLEL_READ_MIN_SIZE) {
+		ThreadWorkPool work_pool;
+		work_pool.init(thread_count);
+		work_pool.do_work(p_count, &job, &BlockDecompressJob::decompress_block, (void *)nullptr);
+		work_pool.finish();
+	} else {
+		for (int i = 0; i < p_count; i++) {
+			job.decompress_block(i, nullptr);
+		}
+	}
 }
 
 Error FileAccessCompressed::get_error() const {
@@ -63,7 +63,27 @@ class FileAccessCompressed : public FileAccess {
 	mutable Vector<uint8_t> buffer;
 	FileAccess *f = nullptr;
 
+	// Reads spanning at least this many bytes of whole blocks decompress them on several threads.
+	static const int PARALLEL_READ_MIN_SIZE = 1024 * 1024;
+
+	struct BlockDecompressJob {
+		const uint8_t *src = nullptr;
+		const ReadBlock *blocks = nullptr;
+		uint8_t *dst = nullptr;
+		int src_offset = 0;
+		int block_size = 0;
+		Compression::Mode mode = Compression::MODE_ZSTD;
+
+		void decompress_block(uint32_t p_index, void *p_userdata);
+	};
+
+	int _get_block_len(int p_block) const;
+	void _load_block(int p_block) const;
+	void _decompress_blocks(int p_from, int p_count, uint8_t *p_dst) const;
+
 public:
+	static Vector<uint8_t> compress_buffer(const uint8_t *p_src, uint32_t p_len, const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size);
+
 	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, int p_block_size = 4096);
 
 	Error open_after_magic(FileAccess *p_base);
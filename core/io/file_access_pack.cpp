@@ -30,8 +30,11 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
+#include "core/io/marshalls.h"
 #include "core/object/script_language.h"
+#include "core/templates/hash_map.h"
 #include "core/version.h"
 
 #include <stdio.h>
@@ -46,7 +49,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, size_t p_
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &pkg_path, const String &path, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &pkg_path, const String &path, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed, bool p_delta) {
 	PathMD5 pmd5(path.md5_buffer());
 	//printf("adding path %s, %lli, %lli\n", path.utf8().get_data(), pmd5.a, pmd5.b);
 
@@ -54,6 +57,8 @@ void PackedData::add_path(const String &pkg_path, const String &path, uint64_t o
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
+	pf.delta = p_delta;
 	pf.pack = pkg_path;
 	pf.offset = ofs;
 	pf.size = size;
@@ -66,6 +71,11 @@ void PackedData::add_path(const String &pkg_path, const String &path, uint64_t o
 		files[pmd5] = pf;
 	}
 
+	PathMD5 cmd5(p_md5);
+	if ((cmd5.a || cmd5.b) && !contents.has(cmd5)) {
+		contents[cmd5] = pf;
+	}
+
 	if (!exists) {
 		//search for dir
 		String p = path.replace_first("res://", "");
@@ -95,6 +105,166 @@ void PackedData::add_path(const String &pkg_path, const String &path, uint64_t o
 	}
 }
 
+Vector<uint8_t> PackedData::compress_file(const Vector<uint8_t> &p_data) {
+	Vector<uint8_t> compressed = FileAccessCompressed::compress_buffer(p_data.ptr(), p_data.size(), PACK_COMPRESSED_MAGIC, Compression::MODE_ZSTD, PACK_COMPRESSED_BLOCK_SIZE);
+
+	// Files that barely compress (e.g. already compressed textures or audio) are
+	// cheaper to load as they are.
+	if (compressed.is_empty() || compressed.size() > p_data.size() - p_data.size() / 16) {
+		return Vector<uint8_t>();
+	}
+	return compressed;
+}
+
+FileAccess *PackedData::try_open_content(const uint8_t *p_md5) {
+	Map<PathMD5, PackedFile>::Element *E = contents.find(PathMD5(p_md5));
+	if (!E) {
+		return nullptr;
+	}
+	return E->get().src->get_file(String(), &E->get());
+}
+
+// Weak checksum from rsync, which can be rolled one byte at a time.
+struct PackDeltaChecksum {
+	uint32_t a = 0;
+	uint32_t b = 0;
+
+	void init(const uint8_t *p_data) {
+		a = 0;
+		b = 0;
+		for (int i = 0; i < PACK_DELTA_BLOCK_SIZE; i++) {
+			a += p_data[i];
+			b += (PACK_DELTA_BLOCK_SIZE - i) * p_data[i];
+		}
+	}
+
+	void roll(uint8_t p_out, uint8_t p_in) {
+		a = a - p_out + p_in;
+		b = b - PACK_DELTA_BLOCK_SIZE * p_out + a;
+	}
+
+	uint32_t get() const {
+		return (a & 0xFFFF) | (b << 16);
+	}
+};
+
+static void _delta_store_32(Vector<uint8_t> &r_out, uint32_t p_value) {
+	int ofs = r_out.size();
+	r_out.resize(ofs + 4);
+	encode_uint32(p_value, &r_out.write[ofs]);
+}
+
+static void _delta_store_literal(Vector<uint8_t> &r_out, uint32_t &r_op_count, const uint8_t *p_data, int p_len) {
+	if (p_len == 0) {
+		return;
+	}
+	_delta_store_32(r_out, PACK_DELTA_LITERAL);
+	_delta_store_32(r_out, p_len);
+	int ofs = r_out.size();
+	r_out.resize(ofs + p_len);
+	memcpy(&r_out.write[ofs], p_data, p_len);
+	r_op_count++;
+}
+
+Vector<uint8_t> PackedData::make_delta(const Vector<uint8_t> &p_base, const uint8_t *p_base_md5, const Vector<uint8_t> &p_data) {
+	const uint8_t *base = p_base.ptr();
+	const uint8_t *data = p_data.ptr();
+	int base_blocks = p_base.size() / PACK_DELTA_BLOCK_SIZE;
+	int size = p_data.size();
+
+	HashMap<uint32_t, uint32_t> block_map;
+	PackDeltaChecksum checksum;
+	for (int i = 0; i < base_blocks; i++) {
+		checksum.init(&base[i * PACK_DELTA_BLOCK_SIZE]);
+		if (!block_map.has(checksum.get())) {
+			block_map[checksum.get()] = i;
+		}
+	}
+
+	Vector<uint8_t> out;
+	_delta_store_32(out, PACK_DELTA_MAGIC);
+	int ofs = out.size();
+	out.resize(ofs + 16);
+	memcpy(&out.write[ofs], p_base_md5, 16);
+	_delta_store_32(out, size);
+	int op_count_ofs = out.size();
+	_delta_store_32(out, 0);
+
+	// Like rsync, look for the blocks of the base at every position of the new data,
+	// so content that moved is still found. Everything else is stored as is.
+	uint32_t op_count = 0;
+	int literal_start = 0;
+	int pos = 0;
+	if (size >= PACK_DELTA_BLOCK_SIZE) {
+		checksum.init(data);
+	}
+	while (pos + PACK_DELTA_BLOCK_SIZE <= size) {
+		const uint32_t *block = block_map.getptr(checksum.get());
+		if (block && memcmp(&base[*block * PACK_DELTA_BLOCK_SIZE], &data[pos], PACK_DELTA_BLOCK_SIZE) == 0) {
+			_delta_store_literal(out, op_count, &data[literal_start], pos - literal_start);
+			_delta_store_32(out, *block);
+			op_count++;
+
+			pos += PACK_DELTA_BLOCK_SIZE;
+			literal_start = pos;
+			if (pos + PACK_DELTA_BLOCK_SIZE <= size) {
+				checksum.init(&data[pos]);
+			}
+			continue;
+		}
+
+		if (pos + PACK_DELTA_BLOCK_SIZE < size) {
+			checksum.roll(data[pos], data[pos + PACK_DELTA_BLOCK_SIZE]);
+		}
+		pos++;
+	}
+	_delta_store_literal(out, op_count, &data[literal_start], size - literal_start);
+
+	encode_uint32(op_count, &out.write[op_count_ofs]);
+	return out;
+}
+
+Error PackedData::apply_delta(const Vector<uint8_t> &p_delta, const Vector<uint8_t> &p_base, Vector<uint8_t> &r_data) {
+	const uint8_t *r = p_delta.ptr();
+	int len = p_delta.size();
+	ERR_FAIL_COND_V(len < 28 || decode_uint32(r) != PACK_DELTA_MAGIC, ERR_FILE_CORRUPT);
+
+	uint32_t size = decode_uint32(&r[20]);
+	uint32_t op_count = decode_uint32(&r[24]);
+	int ofs = 28;
+
+	r_data.resize(size);
+	uint8_t *w = r_data.ptrw();
+	uint32_t pos = 0;
+	for (uint32_t i = 0; i < op_count; i++) {
+		ERR_FAIL_COND_V(ofs + 4 > len, ERR_FILE_CORRUPT);
+		uint32_t op = decode_uint32(&r[ofs]);
+		ofs += 4;
+
+		const uint8_t *src = nullptr;
+		uint32_t src_len = 0;
+		if (op == PACK_DELTA_LITERAL) {
+			ERR_FAIL_COND_V(ofs + 4 > len, ERR_FILE_CORRUPT);
+			src_len = decode_uint32(&r[ofs]);
+			ofs += 4;
+			ERR_FAIL_COND_V(ofs + src_len > (uint32_t)len, ERR_FILE_CORRUPT);
+			src = &r[ofs];
+			ofs += src_len;
+		} else {
+			ERR_FAIL_COND_V((uint64_t(op) + 1) * PACK_DELTA_BLOCK_SIZE > (uint64_t)p_base.size(), ERR_FILE_CORRUPT);
+			src = &p_base[op * PACK_DELTA_BLOCK_SIZE];
+			src_len = PACK_DELTA_BLOCK_SIZE;
+		}
+
+		ERR_FAIL_COND_V(pos + src_len > size, ERR_FILE_CORRUPT);
+		memcpy(&w[pos], src, src_len);
+		pos += src_len;
+	}
+	ERR_FAIL_COND_V(pos != size, ERR_FILE_CORRUPT);
+
+	return OK;
+}
+
 void PackedData::add_pack_source(PackSource *p_source) {
 	if (p_source != nullptr) {
 		sources.push_back(p_source);
@@ -122,11 +292,14 @@ PackedData::~PackedData() {
 		memdelete(sources[i]);
 	}
 	_free_packed_dirs(root);
+	if (singleton == this) {
+		singleton = nullptr;
+	}
 }
 
 //////////////////////////////////////////////////////////////////
 
-bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files, size_t p_offset) {
+bool PackedSourcePCK::read_index(const String &p_path, size_t p_offset, Vector<IndexEntry> &r_entries) {
 	FileAccess *f = FileAccess::open(p_path, FileAccess::READ);
 	if (!f) {
 		return false;
@@ -171,7 +344,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	uint32_t ver_minor = f->get_32();
 	f->get_32(); // patch number, not used for validation.
 
-	if (version != PACK_FORMAT_VERSION) {
+	if (version < PACK_FORMAT_VERSION_MIN || version > PACK_FORMAT_VERSION) {
 		f->close();
 		memdelete(f);
 		ERR_FAIL_V_MSG(false, "Pack version unsupported: " + itos(version) + ".");
@@ -218,23 +391,21 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f = fae;
 	}
 
+	r_entries.resize(file_count);
 	for (int i = 0; i < file_count; i++) {
+		IndexEntry &entry = r_entries.write[i];
+
 		uint32_t sl = f->get_32();
 		CharString cs;
 		cs.resize(sl + 1);
 		f->get_buffer((uint8_t *)cs.ptr(), sl);
 		cs[sl] = 0;
 
-		String path;
-		path.parse_utf8(cs.ptr());
-
-		uint64_t ofs = file_base + f->get_64();
-		uint64_t size = f->get_64();
-		uint8_t md5[16];
-		f->get_buffer(md5, 16);
-		uint32_t flags = f->get_32();
-
-		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+		entry.path.parse_utf8(cs.ptr());
+		entry.offset = file_base + f->get_64() + p_offset;
+		entry.size = f->get_64();
+		f->get_buffer(entry.md5, 16);
+		entry.flags = f->get_32();
 	}
 
 	f->close();
@@ -242,8 +413,65 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	return true;
 }
 
+bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files, size_t p_offset) {
+	Vector<IndexEntry> entries;
+	if (!read_index(p_path, p_offset, entries)) {
+		return false;
+	}
+
+	for (int i = 0; i < entries.size(); i++) {
+		const IndexEntry &entry = entries[i];
+		PackedData::get_singleton()->add_path(p_path, entry.path, entry.offset, entry.size, entry.md5, this, p_replace_files, (entry.flags & PACK_FILE_ENCRYPTED), (entry.flags & PACK_FILE_COMPRESSED), (entry.flags & PACK_FILE_DELTA));
+	}
+
+	_map_pack(p_path);
+
+	return true;
+}
+
+void PackedSourcePCK::_map_pack(const String &p_path) {
+	MutexLock lock(mapped_mutex);
+
+	if (mapped_packs.has(p_path)) {
+		return;
+	}
+
+	FileAccess *f = FileAccess::open(p_path, FileAccess::READ);
+	if (!f) {
+		return;
+	}
+
+	const uint8_t *data = f->map_contents();
+	if (!data) {
+		// Not supported on this platform or file system, files will be read through their own handle.
+		f->close();
+		memdelete(f);
+		return;
+	}
+
+	MappedPack mp;
+	mp.file = f;
+	mp.data = data;
+	mapped_packs[p_path] = mp;
+}
+
 FileAccess *PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file) {
-	return memnew(FileAccessPack(p_path, *p_file));
+	const uint8_t *mapped_pack = nullptr;
+	if (!p_file->encrypted && !p_file->compressed && !p_file->delta) {
+		MutexLock lock(mapped_mutex);
+		Map<String, MappedPack>::Element *E = mapped_packs.find(p_file->pack);
+		if (E) {
+			mapped_pack = E->get().data;
+		}
+	}
+	return memnew(FileAccessPack(p_path, *p_file, mapped_pack));
+}
+
+PackedSourcePCK::~PackedSourcePCK() {
+	for (Map<String, MappedPack>::Element *E = mapped_packs.front(); E; E = E->next()) {
+		E->get().file->close();
+		memdelete(E->get().file);
+	}
 }
 
 //////////////////////////////////////////////////////////////////
@@ -254,11 +482,17 @@ Error FileAccessPack::_open(const String &p_path, int p_mode_flags) {
 }
 
 void FileAccessPack::close() {
-	f->close();
+	if (f) {
+		f->close();
+	}
+	mapped = nullptr;
 }
 
 bool FileAccessPack::is_open() const {
-	return f->is_open();
+	if (mapped) {
+		return true;
+	}
+	return f && f->is_open();
 }
 
 void FileAccessPack::seek(size_t p_position) {
@@ -268,7 +502,9 @@ void FileAccessPack::seek(size_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (f) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -294,6 +530,10 @@ uint8_t FileAccessPack::get_8() const {
 		return 0;
 	}
 
+	if (mapped) {
+		return mapped[pos++];
+	}
+
 	pos++;
 	return f->get_8();
 }
@@ -312,19 +552,38 @@ int FileAccessPack::get_buffer(uint8_t *p_dst, int p_length) const {
 		to_read = int64_t(pf.size) - int64_t(pos);
 	}
 
+	size_t start = pos;
 	pos += p_length;
 
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+	if (mapped) {
+		memcpy(p_dst, mapped + start, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::get_buffer_view(int p_length) const {
+	ERR_FAIL_COND_V(p_length < 0, nullptr);
+
+	if (!mapped || eof || pos + p_length > pf.size) {
+		return nullptr;
+	}
+
+	const uint8_t *view = mapped + pos;
+	pos += p_length;
+	return view;
+}
+
 void FileAccessPack::set_endian_swap(bool p_swap) {
 	FileAccess::set_endian_swap(p_swap);
-	f->set_endian_swap(p_swap);
+	if (f) {
+		f->set_endian_swap(p_swap);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -350,9 +609,19 @@ bool FileAccessPack::file_exists(const String &p_name) {
 	return false;
 }
 
-FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
-		pf(p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
+FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const uint8_t *p_mapped_pack) :
+		pf(p_file) {
+	pos = 0;
+	eof = false;
+
+	if (p_mapped_pack && !pf.encrypted && !pf.compressed && !pf.delta) {
+		// The pack is mapped in memory, read straight from it.
+		mapped = p_mapped_pack + pf.offset;
+		off = pf.offset;
+		return;
+	}
+
+	f = FileAccess::open(pf.pack, FileAccess::READ);
 	ERR_FAIL_COND_MSG(!f, "Can't open pack-referenced file '" + String(pf.pack) + "'.");
 
 	f->seek(pf.offset);
@@ -378,8 +647,51 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
-	pos = 0;
-	eof = false;
+
+	if (pf.compressed) {
+		char magic[5];
+		f->get_buffer((uint8_t *)magic, 4);
+		magic[4] = 0;
+
+		FileAccessCompressed *fac = memnew(FileAccessCompressed);
+		fac->configure(PACK_COMPRESSED_MAGIC, Compression::MODE_ZSTD, PACK_COMPRESSED_BLOCK_SIZE);
+		if (String(magic) != PACK_COMPRESSED_MAGIC || fac->open_after_magic(f) != OK) {
+			memdelete(fac);
+			ERR_FAIL_MSG("Can't open compressed pack-referenced file '" + String(pf.pack) + "'.");
+		}
+		// Blocks are located from the current position, reads then go through the compressed file.
+		f = fac;
+		off = 0;
+		pf.size = fac->get_len();
+	}
+
+	if (pf.delta) {
+		// Rebuilt in memory from its base once, then read like a mapped file.
+		Vector<uint8_t> delta;
+		delta.resize(pf.size);
+		f->get_buffer(delta.ptrw(), delta.size());
+		f->close();
+		memdelete(f);
+		f = nullptr;
+
+		Error err = ERR_FILE_CORRUPT;
+		FileAccess *base_file = delta.size() >= 20 ? PackedData::get_singleton()->try_open_content(&delta[4]) : nullptr;
+		if (base_file) {
+			Vector<uint8_t> base;
+			base.resize(base_file->get_len());
+			base_file->get_buffer(base.ptrw(), base.size());
+			base_file->close();
+			memdelete(base_file);
+
+			err = PackedData::apply_delta(delta, base, delta_data);
+		}
+		if (err != OK) {
+			delta_data.clear();
+		}
+		mapped = delta_data.ptr();
+		pf.size = delta_data.size();
+		ERR_FAIL_COND_MSG(err != OK, "Can't rebuild delta pack-referenced file '" + String(pf.pack) + "', its base must be in a pack loaded before.");
+	}
 }
 
 FileAccessPack::~FileAccessPack() {
@@ -33,6 +33,7 @@
 
 #include "core/os/dir_access.h"
 #include "core/os/file_access.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/list.h"
 #include "core/templates/map.h"
@@ -40,14 +41,29 @@
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
 // The current packed file format version number.
-#define PACK_FORMAT_VERSION 2
+#define PACK_FORMAT_VERSION 3
+// The oldest packed file format version number that can still be read.
+#define PACK_FORMAT_VERSION_MIN 2
+
+// Compressed files are stored in the FileAccessCompressed format, with this magic.
+#define PACK_COMPRESSED_MAGIC "GCPK"
+// Size of the independently decompressed blocks of compressed files.
+#define PACK_COMPRESSED_BLOCK_SIZE 65536
+
+// Delta files ("GDPD" in ASCII) are rebuilt from blocks of another file, found by the MD5
+// of its contents in the packs loaded before, and the bytes that changed.
+#define PACK_DELTA_MAGIC 0x44504447
+#define PACK_DELTA_BLOCK_SIZE 4096
+#define PACK_DELTA_LITERAL 0xFFFFFFFF
 
 enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0
 };
 
 enum PackFileFlags {
-	PACK_FILE_ENCRYPTED = 1 << 0
+	PACK_FILE_ENCRYPTED = 1 << 0,
+	PACK_FILE_COMPRESSED = 1 << 1, // Since version 3.
+	PACK_FILE_DELTA = 1 << 2, // Since version 3.
 };
 
 class PackSource;
@@ -65,6 +81,8 @@ public:
 		uint8_t md5[16];
 		PackSource *src;
 		bool encrypted;
+		bool compressed;
+		bool delta;
 	};
 
 private:
@@ -96,9 +114,15 @@ private:
 			a = *((uint64_t *)&p_buf[0]);
 			b = *((uint64_t *)&p_buf[8]);
 		}
+
+		PathMD5(const uint8_t *p_buf) {
+			memcpy(&a, &p_buf[0], 8);
+			memcpy(&b, &p_buf[8], 8);
+		}
 	};
 
 	Map<PathMD5, PackedFile> files;
+	Map<PathMD5, PackedFile> contents; // By MD5 of the file contents, to find the base of delta files.
 
 	Vector<PackSource *> sources;
 
@@ -111,7 +135,11 @@ private:
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &pkg_path, const String &path, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &pkg_path, const String &path, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_compressed = false, bool p_delta = false); // for PackSource
+
+	static Vector<uint8_t> compress_file(const Vector<uint8_t> &p_data);
+	static Vector<uint8_t> make_delta(const Vector<uint8_t> &p_base, const uint8_t *p_base_md5, const Vector<uint8_t> &p_data);
+	static Error apply_delta(const Vector<uint8_t> &p_delta, const Vector<uint8_t> &p_base, Vector<uint8_t> &r_data);
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -121,6 +149,7 @@ public:
 
 	_FORCE_INLINE_ FileAccess *try_open_path(const String &p_path);
 	_FORCE_INLINE_ bool has_path(const String &p_path);
+	FileAccess *try_open_content(const uint8_t *p_md5);
 
 	_FORCE_INLINE_ DirAccess *try_open_directory(const String &p_path);
 	_FORCE_INLINE_ bool has_directory(const String &p_path);
@@ -137,9 +166,34 @@ public:
 };
 
 class PackedSourcePCK : public PackSource {
+public:
+	struct IndexEntry {
+		String path;
+		uint64_t offset = 0; // From the start of the file holding the pack.
+		uint64_t size = 0;
+		uint8_t md5[16] = {};
+		uint32_t flags = 0;
+	};
+
+	static bool read_index(const String &p_path, size_t p_offset, Vector<IndexEntry> &r_entries);
+
+private:
+	struct MappedPack {
+		FileAccess *file = nullptr;
+		const uint8_t *data = nullptr;
+	};
+
+	// Packs mapped in memory, so files inside them can be read without a file handle each.
+	Map<String, MappedPack> mapped_packs;
+	Mutex mapped_mutex;
+
+	void _map_pack(const String &p_path);
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, size_t p_offset);
 	virtual FileAccess *get_file(const String &p_path, PackedData::PackedFile *p_file);
+
+	~PackedSourcePCK();
 };
 
 class FileAccessPack : public FileAccess {
@@ -149,7 +203,10 @@ class FileAccessPack : public FileAccess {
 	mutable bool eof;
 	uint64_t off;
 
-	FileAccess *f;
+	FileAccess *f = nullptr;
+	const uint8_t *mapped = nullptr; // Start of the file when its pack is mapped in memory, f is null then.
+	Vector<uint8_t> delta_data; // Contents of delta files, rebuilt when opened, mapped points to it.
+
 	virtual Error _open(const String &p_path, int p_mode_flags);
 	virtual uint64_t _get_modified_time(const String &p_file) { return 0; }
 	virtual uint32_t _get_unix_permissions(const String &p_file) { return 0; }
@@ -169,6 +226,7 @@ public:
 	virtual uint8_t get_8() const;
 
 	virtual int get_buffer(uint8_t *p_dst, int p_length) const;
+	virtual const uint8_t *get_buffer_view(int p_length) const;
 
 	virtual void set_endian_swap(bool p_swap);
 
@@ -181,7 +239,7 @@ public:
 
 	virtual bool file_exists(const String &p_name);
 
-	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file);
+	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const uint8_t *p_mapped_pack = nullptr);
 	~FileAccessPack();
 };
 
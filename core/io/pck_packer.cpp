@@ -32,7 +32,6 @@
 
 #include "core/crypto/crypto_core.h"
 #include "core/io/file_access_encrypted.h"
-#include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/os/file_access.h"
 #include "core/version.h"
 
@@ -48,7 +47,8 @@ static int _get_pad(int p_alignment, int p_n) {
 
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_name", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(0), DEFVAL(String()), DEFVAL(false));
-	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("set_patch_base", "base_pck"), &PCKPacker::set_patch_base);
+	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt", "compress"), &PCKPacker::add_file, DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 }
 
@@ -105,12 +105,72 @@ Error PCKPacker::pck_start(const String &p_file, int p_alignment, const String &
 	file->store_32(pack_flags); // flags
 
 	files.clear();
+	stored_contents.clear();
 	ofs = 0;
 
 	return OK;
 }
 
-Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encrypt) {
+Error PCKPacker::set_patch_base(const String &p_base_pck) {
+	patch_base = String();
+	patch_base_files.clear();
+	patch_base_paths.clear();
+	patch_base_contents.clear();
+	if (p_base_pck.is_empty()) {
+		return OK;
+	}
+
+	ERR_FAIL_COND_V_MSG(!PackedSourcePCK::read_index(p_base_pck, 0, patch_base_files), ERR_FILE_UNRECOGNIZED, "Can't read the index of the base pack: " + p_base_pck + ".");
+	patch_base = p_base_pck;
+
+	for (int i = 0; i < patch_base_files.size(); i++) {
+		const PackedSourcePCK::IndexEntry &entry = patch_base_files[i];
+		patch_base_paths[entry.path] = i;
+		String contents = String::hex_encode_buffer(entry.md5, 16);
+		if (entry.flags == 0 && !patch_base_contents.has(contents)) {
+			patch_base_contents[contents] = i;
+		}
+	}
+
+	return OK;
+}
+
+Vector<uint8_t> PCKPacker::_make_patch_delta(const String &p_path, const Vector<uint8_t> &p_data) const {
+	// Prefer the previous version of the file, then the same contents under another path.
+	const PackedSourcePCK::IndexEntry *base = nullptr;
+	const int *base_index = patch_base_paths.getptr(p_path);
+	if (base_index && patch_base_files[*base_index].flags == 0) {
+		base = &patch_base_files[*base_index];
+	}
+	if (!base) {
+		unsigned char hash[16];
+		CryptoCore::md5(p_data.ptr(), p_data.size(), hash);
+		base_index = patch_base_contents.getptr(String::hex_encode_buffer(hash, 16));
+		if (base_index) {
+			base = &patch_base_files[*base_index];
+		}
+	}
+	if (!base) {
+		return Vector<uint8_t>();
+	}
+
+	FileAccess *f = FileAccess::open(patch_base, FileAccess::READ);
+	ERR_FAIL_COND_V(!f, Vector<uint8_t>());
+	Vector<uint8_t> base_data;
+	base_data.resize(base->size);
+	f->seek(base->offset);
+	f->get_buffer(base_data.ptrw(), base_data.size());
+	f->close();
+	memdelete(f);
+
+	Vector<uint8_t> delta = PackedData::make_delta(base_data, base->md5, p_data);
+	if (delta.size() > p_data.size() / 4 * 3) {
+		return Vector<uint8_t>();
+	}
+	return delta;
+}
+
+Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encrypt, bool p_compress) {
 	FileAccess *f = FileAccess::open(p_src, FileAccess::READ);
 	if (!f) {
 		return ERR_FILE_CANT_OPEN;
@@ -133,6 +193,46 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 	}
 	pf.encrypted = p_encrypt;
 
+	f->close();
+	memdelete(f);
+
+	// Unchanged since the base pack, which is loaded before this one.
+	const int *base_index = patch_base_paths.getptr(p_file);
+	if (base_index && memcmp(patch_base_files[*base_index].md5, pf.md5.ptr(), 16) == 0) {
+		return OK;
+	}
+
+	if (!patch_base.is_empty()) {
+		pf.stored_data = _make_patch_delta(p_file, data);
+		if (!pf.stored_data.is_empty()) {
+			pf.delta = true;
+			pf.size = pf.stored_data.size();
+		}
+	}
+
+	if (p_compress && !pf.delta) {
+		// Only kept when it's worth it, see PackedData::compress_file().
+		pf.stored_data = PackedData::compress_file(data);
+		if (!pf.stored_data.is_empty()) {
+			pf.compressed = true;
+			pf.size = pf.stored_data.size();
+		}
+	}
+
+	// Same contents as a file already added, stored the same way.
+	String content_key = String::hex_encode_buffer(pf.md5.ptr(), 16) + itos(pf.encrypted) + itos(pf.compressed) + itos(pf.delta);
+	const int *stored = stored_contents.getptr(content_key);
+	if (stored) {
+		const File &E = files[*stored];
+		pf.ofs = E.ofs;
+		pf.size = E.size;
+		pf.shared = true;
+		pf.stored_data.clear();
+		files.push_back(pf);
+		return OK;
+	}
+	stored_contents[content_key] = files.size();
+
 	uint64_t _size = pf.size;
 	if (p_encrypt) { // Add encryption overhead.
 		if (_size % 16) { // Pad to encryption block size.
@@ -148,9 +248,6 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 
 	files.push_back(pf);
 
-	f->close();
-	memdelete(f);
-
 	return OK;
 }
 
@@ -198,6 +295,12 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
+		if (files[i].delta) {
+			flags |= PACK_FILE_DELTA;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -221,6 +324,10 @@ Error PCKPacker::flush(bool p_verbose) {
 
 	int count = 0;
 	for (int i = 0; i < files.size(); i++) {
+		if (files[i].shared) {
+			continue;
+		}
+
 		FileAccess *src = FileAccess::open(files[i].src_path, FileAccess::READ);
 		uint64_t to_write = files[i].size;
 
@@ -235,6 +342,11 @@ Error PCKPacker::flush(bool p_verbose) {
 			ftmp = fae;
 		}
 
+		if (files[i].compressed || files[i].delta) {
+			ftmp->store_buffer(files[i].stored_data.ptr(), files[i].stored_data.size());
+			to_write = 0;
+		}
+
 		while (to_write > 0) {
 			int read = src->get_buffer(buf, MIN(to_write, buf_max));
 			ftmp->store_buffer(buf, read);
@@ -31,6 +31,7 @@
 #ifndef PCK_PACKER_H
 #define PCK_PACKER_H
 
+#include "core/io/file_access_pack.h"
 #include "core/object/reference.h"
 
 class FileAccess;
@@ -45,21 +46,34 @@ class PCKPacker : public Reference {
 	Vector<uint8_t> key;
 	bool enc_dir = false;
 
+	String patch_base;
+	Vector<PackedSourcePCK::IndexEntry> patch_base_files;
+	HashMap<String, int> patch_base_paths; // Index in patch_base_files.
+	HashMap<String, int> patch_base_contents; // Hex MD5 of plain files, index in patch_base_files.
+
 	static void _bind_methods();
 
+	Vector<uint8_t> _make_patch_delta(const String &p_path, const Vector<uint8_t> &p_data) const;
+
 	struct File {
 		String path;
 		String src_path;
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
+		bool delta = false;
+		bool shared = false; // Same contents as an earlier file, which is used instead.
+		Vector<uint8_t> stored_data; // Written instead of the source file when compressed or delta.
 		Vector<uint8_t> md5;
 	};
 	Vector<File> files;
+	HashMap<String, int> stored_contents; // MD5 and flags of the stored files, index in files.
 
 public:
 	Error pck_start(const String &p_file, int p_alignment = 0, const String &p_key = String(), bool p_encrypt_directory = false);
-	Error add_file(const String &p_file, const String &p_src, bool p_encrypt = false);
+	Error set_patch_base(const String &p_base_pck);
+	Error add_file(const String &p_file, const String &p_src, bool p_encrypt = false, bool p_compress = false);
 	Error flush(bool p_verbose = false);
 
 	PCKPacker() {}
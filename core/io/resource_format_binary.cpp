@@ -100,7 +100,7 @@ void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	}
 }
 
-StringName ResourceLoaderBinary::_get_string() {
+StringName ResourceLoaderBinary::_get_string(int *r_index) {
 	uint32_t id = f->get_32();
 	if (id & 0x80000000) {
 		uint32_t len = id & 0x7FFFFFFF;
@@ -116,9 +116,40 @@ StringName ResourceLoaderBinary::_get_string() {
 		return s;
 	}
 
+	if (r_index) {
+		*r_index = id;
+	}
 	return string_map[id];
 }
 
+void ResourceLoaderBinary::_get_32s(uint32_t *r_values, int p_count) {
+	// A single read instead of one per byte, see FileAccess::get_32().
+	f->get_buffer((uint8_t *)r_values, p_count * sizeof(uint32_t));
+#ifdef BIG_ENDIAN_ENABLED
+	bool swap = !f->get_endian_swap();
+#else
+	bool swap = f->get_endian_swap();
+#endif
+	if (swap) {
+		for (int i = 0; i < p_count; i++) {
+			r_values[i] = BSWAP32(r_values[i]);
+		}
+	}
+}
+
+void ResourceLoaderBinary::_get_reals(real_t *r_values, int p_count) {
+	ERR_FAIL_COND(p_count > 12);
+
+	// Stored in single precision, like FileAccess::get_real() reads them.
+	uint32_t values[12];
+	_get_32s(values, p_count);
+	for (int i = 0; i < p_count; i++) {
+		float value;
+		memcpy(&value, &values[i], sizeof(float));
+		r_values[i] = value;
+	}
+}
+
 Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 	uint32_t type = f->get_32();
 	print_bl("find property of type: " + itos(type));
@@ -146,127 +177,81 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			r_v = get_unicode_string();
 		} break;
 		case VARIANT_VECTOR2: {
-			Vector2 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			r_v = v;
+			real_t c[2];
+			_get_reals(c, 2);
+			r_v = Vector2(c[0], c[1]);
 
 		} break;
 		case VARIANT_VECTOR2I: {
-			Vector2i v;
-			v.x = f->get_32();
-			v.y = f->get_32();
-			r_v = v;
+			uint32_t c[2];
+			_get_32s(c, 2);
+			r_v = Vector2i(c[0], c[1]);
 
 		} break;
 		case VARIANT_RECT2: {
-			Rect2 v;
-			v.position.x = f->get_real();
-			v.position.y = f->get_real();
-			v.size.x = f->get_real();
-			v.size.y = f->get_real();
-			r_v = v;
+			real_t c[4];
+			_get_reals(c, 4);
+			r_v = Rect2(c[0], c[1], c[2], c[3]);
 
 		} break;
 		case VARIANT_RECT2I: {
-			Rect2i v;
-			v.position.x = f->get_32();
-			v.position.y = f->get_32();
-			v.size.x = f->get_32();
-			v.size.y = f->get_32();
-			r_v = v;
+			uint32_t c[4];
+			_get_32s(c, 4);
+			r_v = Rect2i(c[0], c[1], c[2], c[3]);
 
 		} break;
 		case VARIANT_VECTOR3: {
-			Vector3 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
-			r_v = v;
+			real_t c[3];
+			_get_reals(c, 3);
+			r_v = Vector3(c[0], c[1], c[2]);
 		} break;
 		case VARIANT_VECTOR3I: {
-			Vector3i v;
-			v.x = f->get_32();
-			v.y = f->get_32();
-			v.z = f->get_32();
-			r_v = v;
+			uint32_t c[3];
+			_get_32s(c, 3);
+			r_v = Vector3i(c[0], c[1], c[2]);
 		} break;
 		case VARIANT_PLANE: {
-			Plane v;
-			v.normal.x = f->get_real();
-			v.normal.y = f->get_real();
-			v.normal.z = f->get_real();
-			v.d = f->get_real();
-			r_v = v;
+			real_t c[4];
+			_get_reals(c, 4);
+			r_v = Plane(c[0], c[1], c[2], c[3]);
 		} break;
 		case VARIANT_QUAT: {
-			Quat v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
-			v.w = f->get_real();
-			r_v = v;
+			real_t c[4];
+			_get_reals(c, 4);
+			r_v = Quat(c[0], c[1], c[2], c[3]);
 
 		} break;
 		case VARIANT_AABB: {
-			AABB v;
-			v.position.x = f->get_real();
-			v.position.y = f->get_real();
-			v.position.z = f->get_real();
-			v.size.x = f->get_real();
-			v.size.y = f->get_real();
-			v.size.z = f->get_real();
-			r_v = v;
+			real_t c[6];
+			_get_reals(c, 6);
+			r_v = AABB(Vector3(c[0], c[1], c[2]), Vector3(c[3], c[4], c[5]));
 
 		} break;
 		case VARIANT_MATRIX32: {
+			real_t c[6];
+			_get_reals(c, 6);
 			Transform2D v;
-			v.elements[0].x = f->get_real();
-			v.elements[0].y = f->get_real();
-			v.elements[1].x = f->get_real();
-			v.elements[1].y = f->get_real();
-			v.elements[2].x = f->get_real();
-			v.elements[2].y = f->get_real();
+			v.elements[0] = Vector2(c[0], c[1]);
+			v.elements[1] = Vector2(c[2], c[3]);
+			v.elements[2] = Vector2(c[4], c[5]);
 			r_v = v;
 
 		} break;
 		case VARIANT_MATRIX3: {
-			Basis v;
-			v.elements[0].x = f->get_real();
-			v.elements[0].y = f->get_real();
-			v.elements[0].z = f->get_real();
-			v.elements[1].x = f->get_real();
-			v.elements[1].y = f->get_real();
-			v.elements[1].z = f->get_real();
-			v.elements[2].x = f->get_real();
-			v.elements[2].y = f->get_real();
-			v.elements[2].z = f->get_real();
-			r_v = v;
+			real_t c[9];
+			_get_reals(c, 9);
+			r_v = Basis(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8]);
 
 		} break;
 		case VARIANT_TRANSFORM: {
-			Transform v;
-			v.basis.elements[0].x = f->get_real();
-			v.basis.elements[0].y = f->get_real();
-			v.basis.elements[0].z = f->get_real();
-			v.basis.elements[1].x = f->get_real();
-			v.basis.elements[1].y = f->get_real();
-			v.basis.elements[1].z = f->get_real();
-			v.basis.elements[2].x = f->get_real();
-			v.basis.elements[2].y = f->get_real();
-			v.basis.elements[2].z = f->get_real();
-			v.origin.x = f->get_real();
-			v.origin.y = f->get_real();
-			v.origin.z = f->get_real();
-			r_v = v;
+			real_t c[12];
+			_get_reals(c, 12);
+			r_v = Transform(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8], c[9], c[10], c[11]);
 		} break;
 		case VARIANT_COLOR: {
-			Color v; // Colors should always be in single-precision.
-			v.r = f->get_float();
-			v.g = f->get_float();
-			v.b = f->get_float();
-			v.a = f->get_float();
-			r_v = v;
+			real_t c[4]; // Colors should always be in single-precision.
+			_get_reals(c, 4);
+			r_v = Color(c[0], c[1], c[2], c[3]);
 
 		} break;
 		case VARIANT_STRING_NAME: {
@@ -731,10 +716,17 @@ Error ResourceLoaderBinary::load() {
 
 		int pc = f->get_32();
 
+		LocalVector<PropertySetter> *setters = property_setters.getptr(res->get_class_name());
+		if (!setters) {
+			setters = &property_setters[res->get_class_name()];
+			setters->resize(string_map.size());
+		}
+
 		//set properties
 
 		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+			int name_index = -1;
+			StringName name = _get_string(&name_index);
 
 			if (name == StringName()) {
 				error = ERR_FILE_CORRUPT;
@@ -748,7 +740,22 @@ Error ResourceLoaderBinary::load() {
 				return error;
 			}
 
-			res->set(name, value);
+			// Scripts can override any property, so only skip Object::set() without one.
+			const ClassDB::PropertySetGet *setget = nullptr;
+			if (name_index >= 0 && !res->get_script_instance()) {
+				PropertySetter &setter = (*setters)[name_index];
+				if (!setter.cached) {
+					setter.setget = ClassDB::get_property_setget(res->get_class_name(), name);
+					setter.cached = true;
+				}
+				setget = setter.setget;
+			}
+
+			if (setget) {
+				ClassDB::set_property(res.ptr(), setget, value);
+			} else {
+				res->set(name, value);
+			}
 		}
 #ifdef TOOLS_ENABLED
 		res->set_edited(false);
@@ -795,12 +802,21 @@ static String get_ustring(FileAccess *f) {
 
 String ResourceLoaderBinary::get_unicode_string() {
 	int len = f->get_32();
-	if (len > str_buf.size()) {
-		str_buf.resize(len);
-	}
 	if (len == 0) {
 		return String();
 	}
+
+	// Parse in place when the file is in memory.
+	const uint8_t *view = f->get_buffer_view(len);
+	if (view) {
+		String s;
+		s.parse_utf8((const char *)view, len);
+		return s;
+	}
+
+	if (len > str_buf.size()) {
+		str_buf.resize(len);
+	}
 	f->get_buffer((uint8_t *)&str_buf[0], len);
 	String s;
 	s.parse_utf8(&str_buf[0]);
@@ -970,6 +986,8 @@ ResourceLoaderBinary::~ResourceLoaderBinary() {
 	}
 }
 
+ResourceFormatLoaderBinary *ResourceFormatLoaderBinary::singleton = nullptr;
+
 RES ResourceFormatLoaderBinary::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
 	if (r_error) {
 		*r_error = ERR_FILE_CANT_OPEN;
@@ -33,7 +33,10 @@
 
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/object/class_db.h"
 #include "core/os/file_access.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -52,7 +55,16 @@ class ResourceLoaderBinary {
 
 	Vector<StringName> string_map;
 
-	StringName _get_string();
+	StringName _get_string(int *r_index = nullptr);
+	void _get_32s(uint32_t *r_values, int p_count);
+	void _get_reals(real_t *r_values, int p_count);
+
+	// Setters of the properties of each class, by index in string_map, so they're looked up once per file.
+	struct PropertySetter {
+		const ClassDB::PropertySetGet *setget = nullptr;
+		bool cached = false;
+	};
+	HashMap<StringName, LocalVector<PropertySetter>> property_setters;
 
 	struct ExtResource {
 		String path;
@@ -103,6 +115,7 @@ public:
 
 class ResourceFormatLoaderBinary : public ResourceFormatLoader {
 public:
+	static ResourceFormatLoaderBinary *singleton;
 	virtual RES load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE);
 	virtual void get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const;
 	virtual void get_recognized_extensions(List<String> *p_extensions) const;
@@ -110,6 +123,8 @@ public:
 	virtual String get_resource_type(const String &p_path) const;
 	virtual void get_dependencies(const String &p_path, List<String> *p_dependencies, bool p_add_types = false);
 	virtual Error rename_dependencies(const String &p_path, const Map<String, String> &p_map);
+
+	ResourceFormatLoaderBinary() { singleton = this; }
 };
 
 class ResourceFormatSaverBinaryInstance {
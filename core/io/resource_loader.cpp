@@ -210,14 +210,70 @@ RES ResourceLoader::_load(const String &p_path, const String &p_original_path, c
 	ERR_FAIL_V_MSG(RES(), "No loader found for resource: " + p_path + ".");
 }
 
+void ResourceLoader::_thread_load_enqueue(ThreadLoadTask *p_task, ThreadLoadPriority p_priority) {
+	// Must be called with thread_load_mutex locked.
+	p_task->priority = p_priority;
+	p_task->queue_element = thread_load_queue[p_priority].push_back(p_task);
+
+	// Workers are started on demand, up to one per core, and shared by all loads. A new one is only
+	// needed when the workers already waiting can't take all the queued posts.
+	thread_load_pending_posts++;
+	if (thread_load_idle_workers < thread_load_pending_posts && thread_load_workers.size() < (uint32_t)thread_load_max) {
+		Thread *worker = memnew(Thread);
+		worker->start(_thread_load_worker, nullptr);
+		thread_load_workers.push_back(worker);
+	}
+
+	thread_load_semaphore->post();
+}
+
+void ResourceLoader::_thread_load_dequeue(ThreadLoadTask *p_task) {
+	// Must be called with thread_load_mutex locked.
+	// The semaphore post for this task stays, the worker that gets it will find one task less.
+	thread_load_queue[p_task->priority].erase(p_task->queue_element);
+	p_task->queue_element = nullptr;
+	p_task->loader_id = Thread::get_caller_id();
+}
+
+void ResourceLoader::_thread_load_worker(void *p_userdata) {
+	while (true) {
+		thread_load_mutex->lock();
+		thread_load_idle_workers++;
+		thread_load_mutex->unlock();
+
+		thread_load_semaphore->wait();
+
+		thread_load_mutex->lock();
+		thread_load_idle_workers--;
+		thread_load_pending_posts--;
+		if (thread_load_exit) {
+			thread_load_mutex->unlock();
+			return;
+		}
+
+		ThreadLoadTask *task = nullptr;
+		for (int i = 0; i < THREAD_LOAD_PRIORITY_MAX; i++) {
+			if (thread_load_queue[i].size()) {
+				task = thread_load_queue[i].front()->get();
+				_thread_load_dequeue(task);
+				break;
+			}
+		}
+
+		print_lt("WORKER: " + String(task ? "loading " + task->local_path : "nothing to load") + " / queued: " + itos(thread_load_queue[THREAD_LOAD_PRIORITY_DEPENDENCY].size()) + " dependencies, " + itos(thread_load_queue[THREAD_LOAD_PRIORITY_REQUEST].size()) + " requests");
+
+		thread_load_mutex->unlock();
+
+		if (task) {
+			_thread_load_function(task);
+		}
+	}
+}
+
 void ResourceLoader::_thread_load_function(void *p_userdata) {
 	ThreadLoadTask &load_task = *(ThreadLoadTask *)p_userdata;
 	load_task.loader_id = Thread::get_caller_id();
 
-	if (load_task.semaphore) {
-		//this is an actual thread, so wait for Ok from semaphore
-		thread_load_semaphore->wait(); //wait until its ok to start loading
-	}
 	load_task.resource = _load(load_task.remapped_path, load_task.remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, load_task.cache_mode, &load_task.error, load_task.use_sub_threads, &load_task.progress);
 
 	load_task.progress = 1.0; //it was fully loaded at this point, so force progress to 1.0
@@ -229,15 +285,7 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 		load_task.status = THREAD_LOAD_LOADED;
 	}
 	if (load_task.semaphore) {
-		if (load_task.start_next && thread_waiting_count > 0) {
-			thread_waiting_count--;
-			//thread loading count remains constant, this ends but another one begins
-			thread_load_semaphore->post();
-		} else {
-			thread_loading_count--; //no threads waiting, just reduce loading count
-		}
-
-		print_lt("END: load count: " + itos(thread_loading_count) + " / wait count: " + itos(thread_waiting_count) + " / suspended count: " + itos(thread_suspended_count) + " / active: " + itos(thread_loading_count - thread_suspended_count));
+		print_lt("END: " + load_task.local_path + " / waiting: " + itos(load_task.poll_requests));
 
 		for (int i = 0; i < load_task.poll_requests; i++) {
 			load_task.semaphore->post();
@@ -301,9 +349,17 @@ Error ResourceLoader::load_threaded_request(const String &p_path, const String &
 	}
 
 	if (thread_load_tasks.has(local_path)) {
-		thread_load_tasks[local_path].requests++;
+		ThreadLoadTask &load_task = thread_load_tasks[local_path];
+		load_task.requests++;
 		if (p_source_resource != String()) {
 			thread_load_tasks[p_source_resource].sub_tasks.insert(local_path);
+
+			if (load_task.queue_element && load_task.priority != THREAD_LOAD_PRIORITY_DEPENDENCY) {
+				// Now something else depends on it, so it must be loaded sooner.
+				thread_load_queue[load_task.priority].erase(load_task.queue_element);
+				load_task.priority = THREAD_LOAD_PRIORITY_DEPENDENCY;
+				load_task.queue_element = thread_load_queue[THREAD_LOAD_PRIORITY_DEPENDENCY].push_back(&load_task);
+			}
 		}
 		thread_load_mutex->unlock();
 		return OK;
@@ -358,18 +414,9 @@ Error ResourceLoader::load_threaded_request(const String &p_path, const String &
 	if (load_task.resource.is_null()) { //needs  to be loaded in thread
 
 		load_task.semaphore = memnew(Semaphore);
-		if (thread_loading_count < thread_load_max) {
-			thread_loading_count++;
-			thread_load_semaphore->post(); //we have free threads, so allow one
-		} else {
-			thread_waiting_count++;
-		}
-
-		print_lt("REQUEST: load count: " + itos(thread_loading_count) + " / wait count: " + itos(thread_waiting_count) + " / suspended count: " + itos(thread_suspended_count) + " / active: " + itos(thread_loading_count - thread_suspended_count));
+		_thread_load_enqueue(&load_task, p_source_resource != String() ? THREAD_LOAD_PRIORITY_DEPENDENCY : THREAD_LOAD_PRIORITY_REQUEST);
 
-		load_task.thread = memnew(Thread);
-		load_task.thread->start(_thread_load_function, &thread_load_tasks[local_path]);
-		load_task.loader_id = load_task.thread->get_id();
+		print_lt("REQUEST: " + local_path + " / workers: " + itos(thread_load_workers.size()));
 	}
 
 	thread_load_mutex->unlock();
@@ -443,40 +490,29 @@ RES ResourceLoader::load_threaded_get(const String &p_path, Error *r_error) {
 
 	ThreadLoadTask &load_task = thread_load_tasks[local_path];
 
+	if (load_task.queue_element) {
+		// No worker picked it yet, so load it right here instead of waiting. This also
+		// guarantees progress when every worker is blocked on its own dependencies.
+		_thread_load_dequeue(&load_task);
+
+		print_lt("GET: loading " + local_path + " in the calling thread");
+
+		thread_load_mutex->unlock();
+		_thread_load_function(&load_task);
+		thread_load_mutex->lock();
+	}
+
 	//semaphore still exists, meaning it's still loading, request poll
 	Semaphore *semaphore = load_task.semaphore;
 	if (semaphore) {
 		load_task.poll_requests++;
 
-		{
-			// As we got a semaphore, this means we are going to have to wait
-			// until the sub-resource is done loading
-			//
-			// As this thread will become 'blocked' we should "exchange" its
-			// active status with a waiting one, to ensure load continues.
-			//
-			// This ensures loading is never blocked and that is also within
-			// the maximum number of active threads.
-
-			if (thread_waiting_count > 0) {
-				thread_waiting_count--;
-				thread_loading_count++;
-				thread_load_semaphore->post();
-
-				load_task.start_next = false; //do not start next since we are doing it here
-			}
-
-			thread_suspended_count++;
-
-			print_lt("GET: load count: " + itos(thread_loading_count) + " / wait count: " + itos(thread_waiting_count) + " / suspended count: " + itos(thread_suspended_count) + " / active: " + itos(thread_loading_count - thread_suspended_count));
-		}
+		print_lt("GET: waiting for " + local_path);
 
 		thread_load_mutex->unlock();
 		semaphore->wait();
 		thread_load_mutex->lock();
 
-		thread_suspended_count--;
-
 		if (!thread_load_tasks.has(local_path)) { //may have been erased during unlock and this was always an invalid call
 			thread_load_mutex->unlock();
 			if (r_error) {
@@ -494,10 +530,6 @@ RES ResourceLoader::load_threaded_get(const String &p_path, Error *r_error) {
 	load_task.requests--;
 
 	if (load_task.requests == 0) {
-		if (load_task.thread) { //thread may not have been used
-			load_task.thread->wait_to_finish();
-			memdelete(load_task.thread);
-		}
 		thread_load_tasks.erase(local_path);
 	}
 
@@ -1099,13 +1131,29 @@ void ResourceLoader::remove_custom_loaders() {
 void ResourceLoader::initialize() {
 	thread_load_mutex = memnew(Mutex);
 	thread_load_max = OS::get_singleton()->get_processor_count();
-	thread_loading_count = 0;
-	thread_waiting_count = 0;
-	thread_suspended_count = 0;
+	thread_load_exit = false;
 	thread_load_semaphore = memnew(Semaphore);
 }
 
 void ResourceLoader::finalize() {
+	thread_load_mutex->lock();
+	thread_load_exit = true;
+	for (uint32_t i = 0; i < thread_load_workers.size(); i++) {
+		thread_load_semaphore->post();
+	}
+	thread_load_mutex->unlock();
+
+	for (uint32_t i = 0; i < thread_load_workers.size(); i++) {
+		thread_load_workers[i]->wait_to_finish();
+		memdelete(thread_load_workers[i]);
+	}
+	thread_load_workers.clear();
+	thread_load_idle_workers = 0;
+	thread_load_pending_posts = 0;
+	for (int i = 0; i < THREAD_LOAD_PRIORITY_MAX; i++) {
+		thread_load_queue[i].clear();
+	}
+
 	memdelete(thread_load_mutex);
 	memdelete(thread_load_semaphore);
 }
@@ -1121,12 +1169,13 @@ bool ResourceLoader::timestamp_on_load = false;
 
 Mutex *ResourceLoader::thread_load_mutex = nullptr;
 HashMap<String, ResourceLoader::ThreadLoadTask> ResourceLoader::thread_load_tasks;
+List<ResourceLoader::ThreadLoadTask *> ResourceLoader::thread_load_queue[ResourceLoader::THREAD_LOAD_PRIORITY_MAX];
+LocalVector<Thread *> ResourceLoader::thread_load_workers;
 Semaphore *ResourceLoader::thread_load_semaphore = nullptr;
-
-int ResourceLoader::thread_loading_count = 0;
-int ResourceLoader::thread_waiting_count = 0;
-int ResourceLoader::thread_suspended_count = 0;
+bool ResourceLoader::thread_load_exit = false;
 int ResourceLoader::thread_load_max = 0;
+int ResourceLoader::thread_load_idle_workers = 0;
+int ResourceLoader::thread_load_pending_posts = 0;
 
 SelfList<Resource>::List ResourceLoader::remapped_list;
 HashMap<String, Vector<String>> ResourceLoader::translation_remaps;
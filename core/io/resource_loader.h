@@ -34,6 +34,7 @@
 #include "core/io/resource.h"
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 
 class ResourceFormatLoader : public Reference {
 	GDCLASS(ResourceFormatLoader, Reference);
@@ -114,8 +115,15 @@ private:
 
 	static Ref<ResourceFormatLoader> _find_custom_resource_format_loader(String path);
 
+	// Queued loads are picked by the worker threads in this order. Dependencies come first,
+	// since the resource that requested them will block on them.
+	enum ThreadLoadPriority {
+		THREAD_LOAD_PRIORITY_DEPENDENCY,
+		THREAD_LOAD_PRIORITY_REQUEST,
+		THREAD_LOAD_PRIORITY_MAX
+	};
+
 	struct ThreadLoadTask {
-		Thread *thread = nullptr;
 		Thread::ID loader_id = 0;
 		Semaphore *semaphore = nullptr;
 		String local_path;
@@ -128,20 +136,26 @@ private:
 		RES resource;
 		bool xl_remapped = false;
 		bool use_sub_threads = false;
-		bool start_next = true;
 		int requests = 0;
 		int poll_requests = 0;
 		Set<String> sub_tasks;
+		ThreadLoadPriority priority = THREAD_LOAD_PRIORITY_REQUEST;
+		List<ThreadLoadTask *>::Element *queue_element = nullptr; // Set while waiting for a worker.
 	};
 
 	static void _thread_load_function(void *p_userdata);
+	static void _thread_load_worker(void *p_userdata);
+	static void _thread_load_enqueue(ThreadLoadTask *p_task, ThreadLoadPriority p_priority);
+	static void _thread_load_dequeue(ThreadLoadTask *p_task);
 	static Mutex *thread_load_mutex;
 	static HashMap<String, ThreadLoadTask> thread_load_tasks;
+	static List<ThreadLoadTask *> thread_load_queue[THREAD_LOAD_PRIORITY_MAX];
+	static LocalVector<Thread *> thread_load_workers;
 	static Semaphore *thread_load_semaphore;
-	static int thread_waiting_count;
-	static int thread_loading_count;
-	static int thread_suspended_count;
+	static bool thread_load_exit;
 	static int thread_load_max;
+	static int thread_load_idle_workers; // Waiting on the semaphore.
+	static int thread_load_pending_posts; // Posted to the semaphore, not taken by a worker yet.
 
 	static float _dependency_get_progress(const String &p_path);
 
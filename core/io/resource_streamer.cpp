@@ -0,0 +1,335 @@
+/*************************************************************************/
+/*  resource_streamer.cpp                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "resource_streamer.h"
+
+#include "core/config/project_settings.h"
+#include "core/io/resource_loader.h"
+#include "core/os/file_access.h"
+
+ResourceStreamer *ResourceStreamer::singleton = nullptr;
+
+int64_t ResourceStreamer::_estimate_cost(const String &p_path) {
+	// Use the size of the file the resource is loaded from, it's a reasonable proxy
+	// for the memory it takes and doesn't require knowing about each resource type.
+	String path = ResourceLoader::import_remap(ResourceLoader::path_remap(p_path));
+	FileAccess *f = FileAccess::open(path, FileAccess::READ);
+	if (!f) {
+		return 0;
+	}
+	int64_t len = f->get_len();
+	f->close();
+	memdelete(f);
+	return len;
+}
+
+String ResourceStreamer::_get_local_path(const String &p_path) const {
+	if (p_path.is_rel_path()) {
+		return "res://" + p_path;
+	}
+	return ProjectSettings::get_singleton()->localize_path(p_path);
+}
+
+void ResourceStreamer::_start_loads() {
+	while (loading_count < max_concurrent_loads) {
+		Entry *next = nullptr;
+
+		const String *k = nullptr;
+		while ((k = entries.next(k))) {
+			Entry &e = entries[*k];
+			if (e.state == ENTRY_QUEUED && (!next || e.priority < next->priority)) {
+				next = &e;
+			}
+		}
+
+		if (!next) {
+			break;
+		}
+
+		Error err = ResourceLoader::load_threaded_request(next->path, next->type_hint);
+		if (err != OK) {
+			ERR_PRINT("Can't start streaming resource '" + next->path + "'.");
+			entries.erase(next->path);
+			continue;
+		}
+
+		next->state = ENTRY_LOADING;
+		loading_count++;
+	}
+}
+
+void ResourceStreamer::_evict() {
+	while (memory_usage > memory_budget) {
+		Entry *victim = nullptr;
+
+		const String *k = nullptr;
+		while ((k = entries.next(k))) {
+			Entry &e = entries[*k];
+			if (e.state != ENTRY_RESIDENT || e.resource->reference_get_count() > 1) {
+				continue; // Not loaded yet, or still used outside of the streamer.
+			}
+
+			if (!victim) {
+				victim = &e;
+			} else if (e.released != victim->released) {
+				if (e.released) {
+					victim = &e;
+				}
+			} else if (e.priority != victim->priority) {
+				if (e.priority > victim->priority) {
+					victim = &e;
+				}
+			} else if (e.last_used < victim->last_used) {
+				victim = &e;
+			}
+		}
+
+		if (!victim) {
+			break; // Everything in memory is in use, nothing can be done.
+		}
+
+		memory_usage -= victim->cost;
+		eviction_count++;
+		entries.erase(victim->path);
+	}
+}
+
+Error ResourceStreamer::request(const String &p_path, float p_priority, const String &p_type_hint, int64_t p_cost) {
+	ERR_FAIL_COND_V(p_path.is_empty(), ERR_INVALID_PARAMETER);
+
+	MutexLock lock(mutex);
+
+	String local_path = _get_local_path(p_path);
+	Entry *e = entries.getptr(local_path);
+	if (e) {
+		if (e->state == ENTRY_RESIDENT) {
+			hit_count++;
+		} else {
+			miss_count++;
+		}
+		e->priority = p_priority;
+		e->released = false;
+		e->last_used = ++use_counter;
+		return OK;
+	}
+
+	miss_count++;
+
+	Entry entry;
+	entry.path = local_path;
+	entry.type_hint = p_type_hint;
+	entry.priority = p_priority;
+	entry.cost = p_cost;
+	entry.last_used = ++use_counter;
+	entries[local_path] = entry;
+
+	return OK;
+}
+
+void ResourceStreamer::release(const String &p_path) {
+	MutexLock lock(mutex);
+
+	Entry *e = entries.getptr(_get_local_path(p_path));
+	ERR_FAIL_COND_MSG(!e, "Resource '" + p_path + "' was not requested from the streamer.");
+
+	if (e->state == ENTRY_QUEUED) {
+		// Not started, just forget about it.
+		entries.erase(e->path);
+		return;
+	}
+	e->released = true;
+}
+
+RES ResourceStreamer::get(const String &p_path) {
+	MutexLock lock(mutex);
+
+	Entry *e = entries.getptr(_get_local_path(p_path));
+	if (!e || e->state != ENTRY_RESIDENT) {
+		return RES();
+	}
+	e->last_used = ++use_counter;
+	return e->resource;
+}
+
+bool ResourceStreamer::is_resident(const String &p_path) const {
+	MutexLock lock(mutex);
+
+	const Entry *e = entries.getptr(_get_local_path(p_path));
+	return e && e->state == ENTRY_RESIDENT;
+}
+
+void ResourceStreamer::set_memory_budget(uint64_t p_bytes) {
+	MutexLock lock(mutex);
+	memory_budget = p_bytes;
+}
+
+uint64_t ResourceStreamer::get_memory_budget() const {
+	return memory_budget;
+}
+
+uint64_t ResourceStreamer::get_memory_usage() const {
+	return memory_usage;
+}
+
+void ResourceStreamer::set_max_concurrent_loads(int p_count) {
+	ERR_FAIL_COND(p_count < 1);
+	MutexLock lock(mutex);
+	max_concurrent_loads = p_count;
+}
+
+int ResourceStreamer::get_max_concurrent_loads() const {
+	return max_concurrent_loads;
+}
+
+uint64_t ResourceStreamer::get_hit_count() const {
+	return hit_count;
+}
+
+uint64_t ResourceStreamer::get_miss_count() const {
+	return miss_count;
+}
+
+uint64_t ResourceStreamer::get_eviction_count() const {
+	return eviction_count;
+}
+
+void ResourceStreamer::load_settings() {
+	int budget_mb = GLOBAL_DEF("resource_streaming/memory_budget_mb", 512);
+	ProjectSettings::get_singleton()->set_custom_property_info("resource_streaming/memory_budget_mb", PropertyInfo(Variant::INT, "resource_streaming/memory_budget_mb", PROPERTY_HINT_RANGE, "1,65536,1,or_greater"));
+	int max_loads = GLOBAL_DEF("resource_streaming/max_concurrent_loads", 4);
+	ProjectSettings::get_singleton()->set_custom_property_info("resource_streaming/max_concurrent_loads", PropertyInfo(Variant::INT, "resource_streaming/max_concurrent_loads", PROPERTY_HINT_RANGE, "1,64,1"));
+
+	set_memory_budget(uint64_t(MAX(budget_mb, 1)) * 1024 * 1024);
+	set_max_concurrent_loads(MAX(max_loads, 1));
+}
+
+void ResourceStreamer::update() {
+	List<String> loaded_paths;
+	List<RES> loaded;
+
+	{
+		MutexLock lock(mutex);
+
+		if (entries.is_empty()) {
+			return;
+		}
+
+		List<String> failed;
+		const String *k = nullptr;
+		while ((k = entries.next(k))) {
+			Entry &e = entries[*k];
+			if (e.state != ENTRY_LOADING || ResourceLoader::load_threaded_get_status(e.path) == ResourceLoader::THREAD_LOAD_IN_PROGRESS) {
+				continue;
+			}
+
+			loading_count--;
+
+			Error err = OK;
+			RES res = ResourceLoader::load_threaded_get(e.path, &err);
+			if (res.is_null()) {
+				ERR_PRINT("Failed streaming resource '" + e.path + "'.");
+				failed.push_back(e.path);
+				continue;
+			}
+
+			if (e.cost < 0) {
+				e.cost = _estimate_cost(e.path);
+			}
+			e.resource = res;
+			e.state = ENTRY_RESIDENT;
+			memory_usage += e.cost;
+
+			loaded_paths.push_back(e.path);
+			loaded.push_back(res);
+		}
+
+		for (List<String>::Element *E = failed.front(); E; E = E->next()) {
+			entries.erase(E->get());
+		}
+
+		_start_loads();
+		_evict();
+	}
+
+	// Emit outside the lock, so the callbacks can request more resources.
+	List<RES>::Element *R = loaded.front();
+	for (List<String>::Element *E = loaded_paths.front(); E; E = E->next(), R = R->next()) {
+		emit_signal("resource_loaded", E->get(), R->get());
+	}
+}
+
+void ResourceStreamer::clear() {
+	MutexLock lock(mutex);
+
+	const String *k = nullptr;
+	while ((k = entries.next(k))) {
+		if (entries[*k].state == ENTRY_LOADING) {
+			// The loader keeps the task until it's collected.
+			ResourceLoader::load_threaded_get(*k);
+		}
+	}
+
+	entries.clear();
+	memory_usage = 0;
+	loading_count = 0;
+}
+
+void ResourceStreamer::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("request", "path", "priority", "type_hint", "cost"), &ResourceStreamer::request, DEFVAL(0.0), DEFVAL(""), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("release", "path"), &ResourceStreamer::release);
+	ClassDB::bind_method(D_METHOD("get", "path"), &ResourceStreamer::get);
+	ClassDB::bind_method(D_METHOD("is_resident", "path"), &ResourceStreamer::is_resident);
+
+	ClassDB::bind_method(D_METHOD("set_memory_budget", "bytes"), &ResourceStreamer::set_memory_budget);
+	ClassDB::bind_method(D_METHOD("get_memory_budget"), &ResourceStreamer::get_memory_budget);
+	ClassDB::bind_method(D_METHOD("get_memory_usage"), &ResourceStreamer::get_memory_usage);
+
+	ClassDB::bind_method(D_METHOD("set_max_concurrent_loads", "count"), &ResourceStreamer::set_max_concurrent_loads);
+	ClassDB::bind_method(D_METHOD("get_max_concurrent_loads"), &ResourceStreamer::get_max_concurrent_loads);
+
+	ClassDB::bind_method(D_METHOD("get_hit_count"), &ResourceStreamer::get_hit_count);
+	ClassDB::bind_method(D_METHOD("get_miss_count"), &ResourceStreamer::get_miss_count);
+	ClassDB::bind_method(D_METHOD("get_eviction_count"), &ResourceStreamer::get_eviction_count);
+
+	ClassDB::bind_method(D_METHOD("clear"), &ResourceStreamer::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "memory_budget"), "set_memory_budget", "get_memory_budget");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_concurrent_loads"), "set_max_concurrent_loads", "get_max_concurrent_loads");
+
+	ADD_SIGNAL(MethodInfo("resource_loaded", PropertyInfo(Variant::STRING, "path"), PropertyInfo(Variant::OBJECT, "resource", PROPERTY_HINT_RESOURCE_TYPE, "Resource")));
+}
+
+ResourceStreamer::ResourceStreamer() {
+	singleton = this;
+}
+
+ResourceStreamer::~ResourceStreamer() {
+	singleton = nullptr;
+}
@@ -0,0 +1,112 @@
+/*************************************************************************/
+/*  resource_streamer.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef RESOURCE_STREAMER_H
+#define RESOURCE_STREAMER_H
+
+#include "core/io/resource.h"
+#include "core/object/class_db.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+
+// Loads resources in the background on request and keeps them cached within a memory budget.
+// When over budget, resources nothing else references are evicted: released ones first,
+// then the ones with the highest priority value (e.g. the farthest away), then the least recently used.
+class ResourceStreamer : public Object {
+	GDCLASS(ResourceStreamer, Object);
+
+	enum EntryState {
+		ENTRY_QUEUED,
+		ENTRY_LOADING,
+		ENTRY_RESIDENT,
+	};
+
+	struct Entry {
+		String path;
+		String type_hint;
+		RES resource;
+		EntryState state = ENTRY_QUEUED;
+		float priority = 0.0;
+		int64_t cost = -1; // Estimated from the file size when negative.
+		uint64_t last_used = 0;
+		bool released = false;
+	};
+
+	static ResourceStreamer *singleton;
+
+	mutable Mutex mutex;
+	HashMap<String, Entry> entries;
+
+	uint64_t memory_budget = 512 * 1024 * 1024;
+	uint64_t memory_usage = 0;
+	int max_concurrent_loads = 4;
+	int loading_count = 0;
+	uint64_t use_counter = 0;
+
+	uint64_t hit_count = 0;
+	uint64_t miss_count = 0;
+	uint64_t eviction_count = 0;
+
+	static int64_t _estimate_cost(const String &p_path);
+	String _get_local_path(const String &p_path) const;
+	void _start_loads();
+	void _evict();
+
+protected:
+	static void _bind_methods();
+
+public:
+	static ResourceStreamer *get_singleton() { return singleton; }
+
+	Error request(const String &p_path, float p_priority = 0.0, const String &p_type_hint = "", int64_t p_cost = -1);
+	void release(const String &p_path);
+	RES get(const String &p_path);
+	bool is_resident(const String &p_path) const;
+
+	void set_memory_budget(uint64_t p_bytes);
+	uint64_t get_memory_budget() const;
+	uint64_t get_memory_usage() const;
+
+	void set_max_concurrent_loads(int p_count);
+	int get_max_concurrent_loads() const;
+
+	uint64_t get_hit_count() const;
+	uint64_t get_miss_count() const;
+	uint64_t get_eviction_count() const;
+
+	void load_settings();
+	void update();
+	void clear();
+
+	ResourceStreamer();
+	~ResourceStreamer();
+};
+
+#endif // RESOURCE_STREAMER_H
@@ -524,6 +524,28 @@ Object *ClassDB::instance(const StringName &p_class) {
 	return ti->creation_func();
 }
 
+// Returns the function instance() would call for the class, or nullptr if it can't be instanced,
+// so callers creating many objects of the same class can skip the lookup and checks.
+Object *(*ClassDB::get_creation_func(const StringName &p_class))() {
+	OBJTYPE_RLOCK;
+
+	ClassInfo *ti = classes.getptr(p_class);
+	if (!ti || ti->disabled || !ti->creation_func) {
+		if (compat_classes.has(p_class)) {
+			ti = classes.getptr(compat_classes[p_class]);
+		}
+	}
+	if (!ti || ti->disabled) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (ti->api == API_EDITOR && !Engine::get_singleton()->is_editor_hint()) {
+		return nullptr;
+	}
+#endif
+	return ti->creation_func;
+}
+
 bool ClassDB::can_instance(const StringName &p_class) {
 	OBJTYPE_RLOCK;
 
@@ -1095,50 +1117,61 @@ bool ClassDB::get_property_info(StringName p_class, StringName p_property, Prope
 }
 
 bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (!psg->setter) {
-				if (r_valid) {
-					*r_valid = false;
-				}
-				return true; //return true but do nothing
-			}
+	const PropertySetGet *psg = get_property_setget(p_object->get_class_name(), p_property);
+	if (!psg) {
+		return false;
+	}
 
-			Callable::CallError ce;
+	set_property(p_object, psg, p_value, r_valid);
+	return true;
+}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[2] = { &index, &p_value };
-				//p_object->call(psg->setter,arg,2,ce);
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 2, ce);
-				} else {
-					p_object->call(psg->setter, arg, 2, ce);
-				}
+void ClassDB::set_property(Object *p_object, const PropertySetGet *p_setget, const Variant &p_value, bool *r_valid) {
+	if (!p_setget->setter) {
+		if (r_valid) {
+			*r_valid = false;
+		}
+		return; // Do nothing.
+	}
 
-			} else {
-				const Variant *arg[1] = { &p_value };
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 1, ce);
-				} else {
-					p_object->call(psg->setter, arg, 1, ce);
-				}
-			}
+	Callable::CallError ce;
 
-			if (r_valid) {
-				*r_valid = ce.error == Callable::CallError::CALL_OK;
-			}
+	if (p_setget->index >= 0) {
+		Variant index = p_setget->index;
+		const Variant *arg[2] = { &index, &p_value };
+		//p_object->call(psg->setter,arg,2,ce);
+		if (p_setget->_setptr) {
+			p_setget->_setptr->call(p_object, arg, 2, ce);
+		} else {
+			p_object->call(p_setget->setter, arg, 2, ce);
+		}
 
-			return true;
+	} else {
+		const Variant *arg[1] = { &p_value };
+		if (p_setget->_setptr) {
+			p_setget->_setptr->call(p_object, arg, 1, ce);
+		} else {
+			p_object->call(p_setget->setter, arg, 1, ce);
+		}
+	}
+
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
+}
+
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+	ClassInfo *check = classes.getptr(p_class);
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg;
 		}
 
 		check = check->inherits_ptr;
 	}
 
-	return false;
+	return nullptr;
 }
 
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
@@ -33,11 +33,17 @@
 #include "core/config/project_settings.h"
 #include "core/core_string_names.h"
 #include "core/object/script_language.h"
+#include "core/templates/local_vector.h"
 
 MessageQueue *MessageQueue::singleton = nullptr;
+thread_local MessageQueue *MessageQueue::thread_singleton = nullptr;
 
 MessageQueue *MessageQueue::get_singleton() {
-	return singleton;
+	return thread_singleton ? thread_singleton : singleton;
+}
+
+void MessageQueue::set_thread_singleton(MessageQueue *p_queue) {
+	thread_singleton = p_queue;
 }
 
 Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
@@ -335,6 +341,45 @@ void MessageQueue::flush() {
 	_THREAD_SAFE_UNLOCK_
 }
 
+// Moves the messages to another queue, in order, instead of running them.
+void MessageQueue::transfer_to(MessageQueue *p_queue) {
+	_THREAD_SAFE_METHOD_
+
+	uint32_t read_pos = 0;
+	LocalVector<const Variant *> argptrs;
+
+	while (read_pos < buffer_end) {
+		Message *message = (Message *)&buffer[read_pos];
+		Variant *args = (Variant *)(message + 1);
+		int argc = (message->type & FLAG_MASK) != TYPE_NOTIFICATION ? message->args : 0;
+
+		switch (message->type & FLAG_MASK) {
+			case TYPE_CALL: {
+				argptrs.resize(argc);
+				for (int i = 0; i < argc; i++) {
+					argptrs[i] = &args[i];
+				}
+				p_queue->push_callable(message->callable, argptrs.ptr(), argc, message->type & FLAG_SHOW_ERROR);
+			} break;
+			case TYPE_NOTIFICATION: {
+				p_queue->push_notification(message->callable.get_object_id(), message->notification);
+			} break;
+			case TYPE_SET: {
+				p_queue->push_set(message->callable.get_object_id(), message->callable.get_method(), args[0]);
+			} break;
+		}
+
+		for (int i = 0; i < argc; i++) {
+			args[i].~Variant();
+		}
+		message->~Message();
+
+		read_pos += sizeof(Message) + sizeof(Variant) * argc;
+	}
+
+	buffer_end = 0;
+}
+
 bool MessageQueue::is_flushing() const {
 	return flushing;
 }
@@ -349,6 +394,11 @@ MessageQueue::MessageQueue() {
 	buffer = memnew_arr(uint8_t, buffer_size);
 }
 
+MessageQueue::MessageQueue(uint32_t p_buffer_size) {
+	buffer_size = p_buffer_size;
+	buffer = memnew_arr(uint8_t, buffer_size);
+}
+
 MessageQueue::~MessageQueue() {
 	uint32_t read_pos = 0;
 
@@ -369,6 +419,8 @@ MessageQueue::~MessageQueue() {
 		}
 	}
 
-	singleton = nullptr;
+	if (singleton == this) {
+		singleton = nullptr;
+	}
 	memdelete_arr(buffer);
 }
@@ -67,12 +67,19 @@ class MessageQueue {
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
 	static MessageQueue *singleton;
+	static thread_local MessageQueue *thread_singleton;
 
 	bool flushing = false;
 
 public:
 	static MessageQueue *get_singleton();
 
+	// Makes get_singleton() return p_queue on the calling thread, nullptr to restore it.
+	// Used by worker threads whose deferred calls are moved to the main queue afterwards.
+	// Meanwhile, signals emitted on the thread are deferred as well.
+	static void set_thread_singleton(MessageQueue *p_queue);
+	static bool has_thread_singleton() { return thread_singleton != nullptr; }
+
 	Error push_call(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error = false);
 	Error push_call(ObjectID p_id, const StringName &p_method, VARIANT_ARG_LIST);
 	Error push_notification(ObjectID p_id, int p_notification);
@@ -86,12 +93,14 @@ public:
 
 	void statistics();
 	void flush();
+	void transfer_to(MessageQueue *p_queue);
 
 	bool is_flushing() const;
 
 	int get_max_buffer_usage() const;
 
 	MessageQueue();
+	explicit MessageQueue(uint32_t p_buffer_size); // Not a singleton.
 	~MessageQueue();
 };
 
@@ -841,6 +841,7 @@ void Object::set_script(const Variant &p_script) {
 		}
 	}
 
+	notification(NOTIFICATION_SCRIPT_CHANGED);
 	notify_property_list_changed(); //scripts may add variables, so refresh is desired
 	emit_signal(CoreStringNames::get_singleton()->script_changed);
 }
@@ -861,6 +862,8 @@ void Object::set_script_instance(ScriptInstance *p_instance) {
 	} else {
 		script = Variant();
 	}
+
+	notification(NOTIFICATION_SCRIPT_CHANGED);
 }
 
 Variant Object::get_script() const {
@@ -1035,7 +1038,8 @@ Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int
 			argc = bind_mem.size();
 		}
 
-		if (c.flags & CONNECT_DEFERRED) {
+		// Calls from threads processing nodes are deferred, the target may not be safe to use there.
+		if ((c.flags & CONNECT_DEFERRED) || MessageQueue::has_thread_singleton()) {
 			MessageQueue::get_singleton()->push_callable(c.callable, args, argc, true);
 		} else {
 			Callable::CallError ce;
@@ -1584,6 +1588,7 @@ void Object::_bind_methods() {
 
 	BIND_CONSTANT(NOTIFICATION_POSTINITIALIZE);
 	BIND_CONSTANT(NOTIFICATION_PREDELETE);
+	BIND_CONSTANT(NOTIFICATION_SCRIPT_CHANGED);
 
 	BIND_ENUM_CONSTANT(CONNECT_DEFERRED);
 	BIND_ENUM_CONSTANT(CONNECT_PERSIST);
@@ -600,7 +600,8 @@ public:
 
 	enum {
 		NOTIFICATION_POSTINITIALIZE = 0,
-		NOTIFICATION_PREDELETE = 1
+		NOTIFICATION_PREDELETE = 1,
+		NOTIFICATION_SCRIPT_CHANGED = 2
 	};
 
 	/* TYPE API */
@@ -110,6 +110,8 @@ public:
 	virtual real_t get_real() const;
 
 	virtual int get_buffer(uint8_t *p_dst, int p_length) const; ///< get an array of bytes
+	virtual const uint8_t *get_buffer_view(int p_length) const { return nullptr; } ///< get the next p_length bytes without copying them, or nullptr if the contents aren't in memory (use get_buffer then)
+	virtual const uint8_t *map_contents() { return nullptr; } ///< map the whole file in memory if supported, valid until the file is closed
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
@@ -39,6 +39,7 @@
 #include "core/crypto/hashing_context.h"
 #include "core/input/input.h"
 #include "core/input/input_map.h"
+#include "core/io/async_file_io.h"
 #include "core/io/config_file.h"
 #include "core/io/dtls_server.h"
 #include "core/io/http_client.h"
@@ -54,6 +55,7 @@
 #include "core/io/pck_packer.h"
 #include "core/io/resource_format_binary.h"
 #include "core/io/resource_importer.h"
+#include "core/io/resource_streamer.h"
 #include "core/io/stream_peer_ssl.h"
 #include "core/io/tcp_server.h"
 #include "core/io/translation_loader_po.h"
@@ -89,6 +91,8 @@ static _JSON *_json = nullptr;
 static _EngineDebugger *_engine_debugger = nullptr;
 
 static IP *ip = nullptr;
+static ResourceStreamer *resource_streamer = nullptr;
+static AsyncFileIO *async_file_io = nullptr;
 
 static _Geometry2D *_geometry_2d = nullptr;
 static _Geometry3D *_geometry_3d = nullptr;
@@ -215,7 +219,11 @@ void register_core_types() {
 
 	ClassDB::register_virtual_class<ResourceImporter>();
 
+	ClassDB::register_virtual_class<AsyncFileRequest>();
+
 	ip = IP::create();
+	resource_streamer = memnew(ResourceStreamer);
+	async_file_io = memnew(AsyncFileIO);
 
 	_geometry_2d = memnew(_Geometry2D);
 	_geometry_3d = memnew(_Geometry3D);
@@ -239,11 +247,15 @@ void register_core_settings() {
 
 	GLOBAL_DEF("network/ssl/certificate_bundle_override", "");
 	ProjectSettings::get_singleton()->set_custom_property_info("network/ssl/certificate_bundle_override", PropertyInfo(Variant::STRING, "network/ssl/certificate_bundle_override", PROPERTY_HINT_FILE, "*.crt"));
+
+	resource_streamer->load_settings();
 }
 
 void register_core_singletons() {
 	ClassDB::register_class<ProjectSettings>();
 	ClassDB::register_virtual_class<IP>();
+	ClassDB::register_virtual_class<ResourceStreamer>();
+	ClassDB::register_virtual_class<AsyncFileIO>();
 	ClassDB::register_class<_Geometry2D>();
 	ClassDB::register_class<_Geometry3D>();
 	ClassDB::register_class<_ResourceLoader>();
@@ -265,6 +277,8 @@ void register_core_singletons() {
 	Engine::get_singleton()->add_singleton(Engine::Singleton("Geometry3D", _Geometry3D::get_singleton()));
 	Engine::get_singleton()->add_singleton(Engine::Singleton("ResourceLoader", _ResourceLoader::get_singleton()));
 	Engine::get_singleton()->add_singleton(Engine::Singleton("ResourceSaver", _ResourceSaver::get_singleton()));
+	Engine::get_singleton()->add_singleton(Engine::Singleton("ResourceStreamer", ResourceStreamer::get_singleton()));
+	Engine::get_singleton()->add_singleton(Engine::Singleton("AsyncFileIO", AsyncFileIO::get_singleton()));
 	Engine::get_singleton()->add_singleton(Engine::Singleton("OS", _OS::get_singleton()));
 	Engine::get_singleton()->add_singleton(Engine::Singleton("Engine", _Engine::get_singleton()));
 	Engine::get_singleton()->add_singleton(Engine::Singleton("ClassDB", _classdb));
@@ -313,6 +327,9 @@ void unregister_core_types() {
 		memdelete(ip);
 	}
 
+	memdelete(resource_streamer);
+	memdelete(async_file_io);
+
 	ResourceLoader::finalize();
 
 	ClassDB::cleanup_defaults();
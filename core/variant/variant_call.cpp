@@ -590,6 +590,150 @@ struct _VariantCall {
 		return s;
 	}
 
+	// Bulk math on packed arrays. The loops work on raw pointers so the compiler can vectorize them.
+
+	template <class T>
+	static Vector<T> func_PackedArray_add(Vector<T> *p_instance, const Vector<T> &p_array) {
+		Vector<T> result;
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_array.size(), result, "Both arrays must have the same size.");
+		int size = p_instance->size();
+		result.resize(size);
+		const T *a = p_instance->ptr();
+		const T *b = p_array.ptr();
+		T *r = result.ptrw();
+		for (int i = 0; i < size; i++) {
+			r[i] = a[i] + b[i];
+		}
+		return result;
+	}
+
+	template <class T>
+	static Vector<T> func_PackedArray_multiply(Vector<T> *p_instance, const Vector<T> &p_array) {
+		Vector<T> result;
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_array.size(), result, "Both arrays must have the same size.");
+		int size = p_instance->size();
+		result.resize(size);
+		const T *a = p_instance->ptr();
+		const T *b = p_array.ptr();
+		T *r = result.ptrw();
+		for (int i = 0; i < size; i++) {
+			r[i] = a[i] * b[i];
+		}
+		return result;
+	}
+
+	template <class T>
+	static Vector<T> func_PackedArray_scale(Vector<T> *p_instance, float p_scale) {
+		Vector<T> result;
+		int size = p_instance->size();
+		result.resize(size);
+		const T *a = p_instance->ptr();
+		T *r = result.ptrw();
+		for (int i = 0; i < size; i++) {
+			r[i] = a[i] * p_scale;
+		}
+		return result;
+	}
+
+	template <class T>
+	static Vector<T> func_PackedArray_lerp(Vector<T> *p_instance, const Vector<T> &p_to, float p_weight) {
+		Vector<T> result;
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_to.size(), result, "Both arrays must have the same size.");
+		int size = p_instance->size();
+		result.resize(size);
+		const T *a = p_instance->ptr();
+		const T *b = p_to.ptr();
+		T *r = result.ptrw();
+		for (int i = 0; i < size; i++) {
+			r[i] = a[i] + (b[i] - a[i]) * p_weight;
+		}
+		return result;
+	}
+
+	template <class T>
+	static T func_PackedArray_sum(Vector<T> *p_instance) {
+		T sum = T();
+		int size = p_instance->size();
+		const T *a = p_instance->ptr();
+		for (int i = 0; i < size; i++) {
+			sum += a[i];
+		}
+		return sum;
+	}
+
+	template <class T>
+	static Vector<float> func_PackedArray_dot(Vector<T> *p_instance, const Vector<T> &p_array) {
+		Vector<float> result;
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_array.size(), result, "Both arrays must have the same size.");
+		int size = p_instance->size();
+		result.resize(size);
+		const T *a = p_instance->ptr();
+		const T *b = p_array.ptr();
+		float *r = result.ptrw();
+		for (int i = 0; i < size; i++) {
+			r[i] = a[i].dot(b[i]);
+		}
+		return result;
+	}
+
+	template <class T>
+	static Vector<float> func_PackedArray_lengths(Vector<T> *p_instance) {
+		Vector<float> result;
+		int size = p_instance->size();
+		result.resize(size);
+		const T *a = p_instance->ptr();
+		float *r = result.ptrw();
+		for (int i = 0; i < size; i++) {
+			r[i] = a[i].length();
+		}
+		return result;
+	}
+
+	static double func_PackedFloat32Array_sum(PackedFloat32Array *p_instance) {
+		// Accumulate in double precision, long arrays would lose too much otherwise.
+		double sum = 0.0;
+		int size = p_instance->size();
+		const float *a = p_instance->ptr();
+		for (int i = 0; i < size; i++) {
+			sum += a[i];
+		}
+		return sum;
+	}
+
+	static double func_PackedFloat32Array_min(PackedFloat32Array *p_instance) {
+		int size = p_instance->size();
+		ERR_FAIL_COND_V_MSG(size == 0, 0.0, "Can't get the minimum of an empty array.");
+		const float *a = p_instance->ptr();
+		float m = a[0];
+		for (int i = 1; i < size; i++) {
+			m = MIN(m, a[i]);
+		}
+		return m;
+	}
+
+	static double func_PackedFloat32Array_max(PackedFloat32Array *p_instance) {
+		int size = p_instance->size();
+		ERR_FAIL_COND_V_MSG(size == 0, 0.0, "Can't get the maximum of an empty array.");
+		const float *a = p_instance->ptr();
+		float m = a[0];
+		for (int i = 1; i < size; i++) {
+			m = MAX(m, a[i]);
+		}
+		return m;
+	}
+
+	static PackedFloat32Array func_PackedFloat32Array_clamp(PackedFloat32Array *p_instance, float p_min, float p_max) {
+		PackedFloat32Array result;
+		int size = p_instance->size();
+		result.resize(size);
+		const float *a = p_instance->ptr();
+		float *r = result.ptrw();
+		for (int i = 0; i < size; i++) {
+			r[i] = CLAMP(a[i], p_min, p_max);
+		}
+		return result;
+	}
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = VariantGetInternalPtr<Callable>::get_ptr(v);
 		callable->call(p_args, p_argcount, r_ret, r_error);
@@ -1545,6 +1689,15 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat32Array, sort, sarray(), varray());
 	bind_method(PackedFloat32Array, duplicate, sarray(), varray());
 
+	bind_function(PackedFloat32Array, add, _VariantCall::func_PackedArray_add<float>, sarray("array"), varray());
+	bind_function(PackedFloat32Array, multiply, _VariantCall::func_PackedArray_multiply<float>, sarray("array"), varray());
+	bind_function(PackedFloat32Array, scale, _VariantCall::func_PackedArray_scale<float>, sarray("scale"), varray());
+	bind_function(PackedFloat32Array, lerp, _VariantCall::func_PackedArray_lerp<float>, sarray("to", "weight"), varray());
+	bind_function(PackedFloat32Array, clamp, _VariantCall::func_PackedFloat32Array_clamp, sarray("min", "max"), varray());
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_PackedFloat32Array_sum, sarray(), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_PackedFloat32Array_min, sarray(), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_PackedFloat32Array_max, sarray(), varray());
+
 	/* Float64 Array */
 
 	bind_method(PackedFloat64Array, size, sarray(), varray());
@@ -1599,6 +1752,14 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector2Array, sort, sarray(), varray());
 	bind_method(PackedVector2Array, duplicate, sarray(), varray());
 
+	bind_function(PackedVector2Array, add, _VariantCall::func_PackedArray_add<Vector2>, sarray("array"), varray());
+	bind_function(PackedVector2Array, multiply, _VariantCall::func_PackedArray_multiply<Vector2>, sarray("array"), varray());
+	bind_function(PackedVector2Array, scale, _VariantCall::func_PackedArray_scale<Vector2>, sarray("scale"), varray());
+	bind_function(PackedVector2Array, lerp, _VariantCall::func_PackedArray_lerp<Vector2>, sarray("to", "weight"), varray());
+	bind_function(PackedVector2Array, sum, _VariantCall::func_PackedArray_sum<Vector2>, sarray(), varray());
+	bind_function(PackedVector2Array, dot, _VariantCall::func_PackedArray_dot<Vector2>, sarray("array"), varray());
+	bind_function(PackedVector2Array, lengths, _VariantCall::func_PackedArray_lengths<Vector2>, sarray(), varray());
+
 	/* Vector3 Array */
 
 	bind_method(PackedVector3Array, size, sarray(), varray());
@@ -1617,6 +1778,14 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector3Array, sort, sarray(), varray());
 	bind_method(PackedVector3Array, duplicate, sarray(), varray());
 
+	bind_function(PackedVector3Array, add, _VariantCall::func_PackedArray_add<Vector3>, sarray("array"), varray());
+	bind_function(PackedVector3Array, multiply, _VariantCall::func_PackedArray_multiply<Vector3>, sarray("array"), varray());
+	bind_function(PackedVector3Array, scale, _VariantCall::func_PackedArray_scale<Vector3>, sarray("scale"), varray());
+	bind_function(PackedVector3Array, lerp, _VariantCall::func_PackedArray_lerp<Vector3>, sarray("to", "weight"), varray());
+	bind_function(PackedVector3Array, sum, _VariantCall::func_PackedArray_sum<Vector3>, sarray(), varray());
+	bind_function(PackedVector3Array, dot, _VariantCall::func_PackedArray_dot<Vector3>, sarray("array"), varray());
+	bind_function(PackedVector3Array, lengths, _VariantCall::func_PackedArray_lengths<Vector3>, sarray(), varray());
+
 	/* Color Array */
 
 	bind_method(PackedColorArray, size, sarray(), varray());
@@ -34,40 +34,47 @@
 #include "core/io/resource_loader.h"
 #include "core/os/keyboard.h"
 #include "core/string/string_buffer.h"
+#include "core/templates/local_vector.h"
+
+char32_t VariantParser::Stream::_refill_and_get_char() {
+	readahead_pointer = 0;
+	readahead_filled = _read_buffer(readahead_buffer, readahead_enabled ? READAHEAD_SIZE : 1);
+	if (readahead_filled == 0) {
+		// You need to try to read again when you have reached the end for EOF to be reported.
+		eof = true;
+		return 0;
+	}
 
-char32_t VariantParser::StreamFile::get_char() {
-	return f->get_8();
+	return readahead_buffer[readahead_pointer++];
 }
 
-bool VariantParser::StreamFile::is_utf8() const {
-	return true;
+uint32_t VariantParser::StreamFile::_read_buffer(char32_t *p_buffer, uint32_t p_num_chars) {
+	uint8_t bytes[READAHEAD_SIZE];
+	int num_read = f->get_buffer(bytes, MIN(p_num_chars, (uint32_t)READAHEAD_SIZE));
+	for (int i = 0; i < num_read; i++) {
+		p_buffer[i] = bytes[i];
+	}
+	return MAX(num_read, 0);
 }
 
-bool VariantParser::StreamFile::is_eof() const {
-	return f->eof_reached();
+bool VariantParser::StreamFile::is_utf8() const {
+	return true;
 }
 
-char32_t VariantParser::StreamString::get_char() {
-	if (pos > s.length()) {
-		return 0;
-	} else if (pos == s.length()) {
-		// You need to try to read again when you have reached the end for EOF to be reported,
-		// so this works the same as files (like StreamFile does)
-		pos++;
-		return 0;
-	} else {
-		return s[pos++];
+uint32_t VariantParser::StreamString::_read_buffer(char32_t *p_buffer, uint32_t p_num_chars) {
+	int available = MAX(s.length() - pos, 0);
+	uint32_t num_read = MIN((uint32_t)available, p_num_chars);
+	if (num_read) {
+		memcpy(p_buffer, s.ptr() + pos, num_read * sizeof(char32_t));
 	}
+	pos += num_read;
+	return num_read;
 }
 
 bool VariantParser::StreamString::is_utf8() const {
 	return false;
 }
 
-bool VariantParser::StreamString::is_eof() const {
-	return pos > s.length();
-}
-
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 const char *VariantParser::tk_name[TK_MAX] = {
@@ -448,6 +455,9 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 		return ERR_PARSE_ERROR;
 	}
 
+	// Grown geometrically and copied once, as packed arrays can have many elements.
+	LocalVector<T> values;
+
 	bool first = true;
 	while (true) {
 		if (!first) {
@@ -470,10 +480,15 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 			return ERR_PARSE_ERROR;
 		}
 
-		r_construct.push_back(token.value);
+		values.push_back(token.value);
 		first = false;
 	}
 
+	r_construct.resize(values.size());
+	if (values.size()) {
+		memcpy(r_construct.ptrw(), values.ptr(), values.size() * sizeof(T));
+	}
+
 	return OK;
 }
 
@@ -875,17 +890,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<uint8_t> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				uint8_t *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt32Array" || id == "PackedIntArray" || id == "PoolIntArray" || id == "IntArray") {
 			Vector<int32_t> args;
 			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
@@ -893,17 +898,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int32_t> arr;
-			{
-				int32_t len = args.size();
-				arr.resize(len);
-				int32_t *w = arr.ptrw();
-				for (int32_t i = 0; i < len; i++) {
-					w[i] = int32_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt64Array") {
 			Vector<int64_t> args;
 			Error err = _parse_construct<int64_t>(p_stream, args, line, r_err_str);
@@ -911,17 +906,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int64_t> arr;
-			{
-				int64_t len = args.size();
-				arr.resize(len);
-				int64_t *w = arr.ptrw();
-				for (int64_t i = 0; i < len; i++) {
-					w[i] = int64_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat32Array" || id == "PackedRealArray" || id == "PoolRealArray" || id == "FloatArray") {
 			Vector<float> args;
 			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
@@ -929,17 +914,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<float> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				float *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat64Array") {
 			Vector<double> args;
 			Error err = _parse_construct<double>(p_stream, args, line, r_err_str);
@@ -947,17 +922,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<double> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				double *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedStringArray" || id == "PoolStringArray" || id == "StringArray") {
 			get_token(p_stream, token, line, r_err_str);
 			if (token.type != TK_PARENTHESIS_OPEN) {
@@ -38,33 +38,61 @@
 class VariantParser {
 public:
 	struct Stream {
-		virtual char32_t get_char() = 0;
-		virtual bool is_utf8() const = 0;
-		virtual bool is_eof() const = 0;
+	protected:
+		enum {
+			READAHEAD_SIZE = 2048
+		};
+
+	private:
+		char32_t readahead_buffer[READAHEAD_SIZE];
+		uint32_t readahead_pointer = 0;
+		uint32_t readahead_filled = 0;
+		bool eof = false;
+
+		char32_t _refill_and_get_char();
+
+	protected:
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) = 0;
 
+	public:
 		char32_t saved = 0;
+		// Characters are read in chunks, disable before the first read to keep the source at the position parsed.
+		bool readahead_enabled = true;
+
+		_FORCE_INLINE_ char32_t get_char() {
+			if (readahead_pointer < readahead_filled) {
+				return readahead_buffer[readahead_pointer++];
+			}
+			return _refill_and_get_char();
+		}
+		virtual bool is_utf8() const = 0;
+		bool is_eof() const { return eof; }
 
 		Stream() {}
 		virtual ~Stream() {}
 	};
 
 	struct StreamFile : public Stream {
+	protected:
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars);
+
+	public:
 		FileAccess *f = nullptr;
 
-		virtual char32_t get_char();
 		virtual bool is_utf8() const;
-		virtual bool is_eof() const;
 
 		StreamFile() {}
 	};
 
 	struct StreamString : public Stream {
+	protected:
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars);
+
+	public:
 		String s;
 		int pos = 0;
 
-		virtual char32_t get_char();
 		virtual bool is_utf8() const;
-		virtual bool is_eof() const;
 
 		StreamString() {}
 	};
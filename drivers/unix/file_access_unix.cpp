@@ -41,6 +41,7 @@
 #include <errno.h>
 
 #if defined(UNIX_ENABLED)
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
@@ -153,6 +154,14 @@ void FileAccessUnix::close() {
 		return;
 	}
 
+#if defined(UNIX_ENABLED)
+	if (mapped) {
+		munmap(mapped, mapped_size);
+		mapped = nullptr;
+		mapped_size = 0;
+	}
+#endif
+
 	fclose(f);
 	f = nullptr;
 
@@ -248,6 +257,34 @@ int FileAccessUnix::get_buffer(uint8_t *p_dst, int p_length) const {
 	return read;
 };
 
+const uint8_t *FileAccessUnix::map_contents() {
+	ERR_FAIL_COND_V_MSG(!f, nullptr, "File must be opened before use.");
+
+#if defined(UNIX_ENABLED)
+	if (mapped) {
+		return mapped;
+	}
+	if (flags != READ) {
+		return nullptr;
+	}
+
+	size_t size = get_len();
+	if (size == 0) {
+		return nullptr;
+	}
+
+	void *ptr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (ptr == MAP_FAILED) {
+		return nullptr;
+	}
+	mapped = (uint8_t *)ptr;
+	mapped_size = size;
+	return mapped;
+#else
+	return nullptr;
+#endif
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -43,6 +43,8 @@ typedef void (*CloseNotificationFunc)(const String &p_file, int p_flags);
 class FileAccessUnix : public FileAccess {
 	FILE *f = nullptr;
 	int flags = 0;
+	uint8_t *mapped = nullptr;
+	size_t mapped_size = 0;
 	void check_errors() const;
 	mutable Error last_error = OK;
 	String save_path;
@@ -70,6 +72,7 @@ public:
 
 	virtual uint8_t get_8() const; ///< get a byte
 	virtual int get_buffer(uint8_t *p_dst, int p_length) const;
+	virtual const uint8_t *map_contents();
 
 	virtual Error get_error() const; ///< get last error
 
@@ -230,6 +230,15 @@ bool EditorExportPreset::get_enc_directory() const {
 	return enc_directory;
 }
 
+void EditorExportPreset::set_compress_pck(bool p_enabled) {
+	compress_pck = p_enabled;
+	EditorExport::singleton->save_presets();
+}
+
+bool EditorExportPreset::get_compress_pck() const {
+	return compress_pck;
+}
+
 void EditorExportPreset::set_script_export_mode(int p_mode) {
 	script_mode = p_mode;
 	EditorExport::singleton->save_presets();
@@ -311,6 +320,16 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 	sd.size = p_data.size();
 	sd.encrypted = false;
 
+	// Only kept for the files where it's worth it, see PackedData::compress_file().
+	Vector<uint8_t> compressed_data;
+	if (pd->compress) {
+		compressed_data = PackedData::compress_file(p_data);
+		if (!compressed_data.is_empty()) {
+			sd.compressed = true;
+			sd.size = compressed_data.size();
+		}
+	}
+
 	for (int i = 0; i < p_enc_in_filters.size(); ++i) {
 		if (p_path.matchn(p_enc_in_filters[i]) || p_path.replace("res://", "").matchn(p_enc_in_filters[i])) {
 			sd.encrypted = true;
@@ -325,6 +344,30 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 		}
 	}
 
+	// Store MD5 of original file.
+	{
+		unsigned char hash[16];
+		CryptoCore::md5(p_data.ptr(), p_data.size(), hash);
+		sd.md5.resize(16);
+		for (int i = 0; i < 16; i++) {
+			sd.md5.write[i] = hash[i];
+		}
+	}
+
+	// Files with the same contents, stored the same way, point to a single copy.
+	String content_key = String::hex_encode_buffer(sd.md5.ptr(), 16) + itos(sd.encrypted) + itos(sd.compressed);
+	Map<String, int>::Element *E = pd->stored_contents.find(content_key);
+	if (E) {
+		sd.ofs = pd->file_ofs[E->get()].ofs;
+		pd->file_ofs.push_back(sd);
+
+		if (pd->ep->step(TTR("Storing File:") + " " + p_path, 2 + p_file * 100 / p_total, false)) {
+			return ERR_SKIP;
+		}
+		return OK;
+	}
+	pd->stored_contents[content_key] = pd->file_ofs.size();
+
 	FileAccessEncrypted *fae = nullptr;
 	FileAccess *ftmp = pd->f;
 
@@ -338,7 +381,11 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 	}
 
 	// Store file content.
-	ftmp->store_buffer(p_data.ptr(), p_data.size());
+	if (sd.compressed) {
+		ftmp->store_buffer(compressed_data.ptr(), compressed_data.size());
+	} else {
+		ftmp->store_buffer(p_data.ptr(), p_data.size());
+	}
 
 	if (fae) {
 		fae->release();
@@ -350,16 +397,6 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 		pd->f->store_8(Math::rand() % 256);
 	}
 
-	// Store MD5 of original file.
-	{
-		unsigned char hash[16];
-		CryptoCore::md5(p_data.ptr(), p_data.size(), hash);
-		sd.md5.resize(16);
-		for (int i = 0; i < 16; i++) {
-			sd.md5.write[i] = hash[i];
-		}
-	}
-
 	pd->file_ofs.push_back(sd);
 
 	if (pd->ep->step(TTR("Storing File:") + " " + p_path, 2 + p_file * 100 / p_total, false)) {
@@ -1090,6 +1127,7 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, c
 	pd.ep = &ep;
 	pd.f = ftmp;
 	pd.so_files = p_so_files;
+	pd.compress = p_preset->get_compress_pck();
 
 	Error err = export_project_files(p_preset, _save_pack_file, &pd, _add_shared_object);
 
@@ -1218,6 +1256,9 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, c
 		if (pd.file_ofs[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (pd.file_ofs[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -1407,6 +1448,7 @@ void EditorExport::_save() {
 		config->set_value(section, "encryption_exclude_filters", preset->get_enc_ex_filter());
 		config->set_value(section, "encrypt_pck", preset->get_enc_pck());
 		config->set_value(section, "encrypt_directory", preset->get_enc_directory());
+		config->set_value(section, "compress_pck", preset->get_compress_pck());
 		config->set_value(section, "script_export_mode", preset->get_script_export_mode());
 		config->set_value(section, "script_encryption_key", preset->get_script_encryption_key());
 
@@ -1596,6 +1638,9 @@ void EditorExport::load_config() {
 		if (config->has_section_key(section, "encrypt_directory")) {
 			preset->set_enc_directory(config->get_value(section, "encrypt_directory"));
 		}
+		if (config->has_section_key(section, "compress_pck")) {
+			preset->set_compress_pck(config->get_value(section, "compress_pck"));
+		}
 		if (config->has_section_key(section, "encryption_include_filters")) {
 			preset->set_enc_in_filter(config->get_value(section, "encryption_include_filters"));
 		}
@@ -82,6 +82,7 @@ private:
 	String enc_ex_filters;
 	bool enc_pck = false;
 	bool enc_directory = false;
+	bool compress_pck = false;
 
 	int script_mode = MODE_SCRIPT_COMPILED;
 	String script_key;
@@ -137,6 +138,9 @@ public:
 	void set_enc_directory(bool p_enabled);
 	bool get_enc_directory() const;
 
+	void set_compress_pck(bool p_enabled);
+	bool get_compress_pck() const;
+
 	void set_script_export_mode(int p_mode);
 	int get_script_export_mode() const;
 
@@ -172,6 +176,7 @@ private:
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
 		Vector<uint8_t> md5;
 		CharString path_utf8;
 
@@ -185,6 +190,8 @@ private:
 		Vector<SavedData> file_ofs;
 		EditorProgress *ep = nullptr;
 		Vector<SharedObject> *so_files = nullptr;
+		bool compress = false;
+		Map<String, int> stored_contents; // MD5 and flags of the stored files, to share identical ones.
 	};
 
 	struct ZipData {
@@ -2111,6 +2111,7 @@ void EditorFileSystem::_update_extensions() {
 EditorFileSystem::EditorFileSystem() {
 	ResourceLoader::import = _resource_import;
 	reimport_on_missing_imported_files = GLOBAL_DEF("editor/import/reimport_missing_imported_files", true);
+	GLOBAL_DEF("editor/import/use_binary_cache_for_text_resources", false);
 
 	singleton = this;
 	filesystem = memnew(EditorFileSystemDirectory); //like, empty
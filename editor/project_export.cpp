@@ -297,6 +297,8 @@ void ProjectExportDialog::_edit_preset(int p_index) {
 	int script_export_mode = current->get_script_export_mode();
 	script_mode->select(script_export_mode);
 
+	compress_pck->set_pressed(current->get_compress_pck());
+
 	String key = current->get_script_encryption_key();
 	if (!updating_script_key) {
 		script_key->set_text(key);
@@ -498,6 +500,19 @@ void ProjectExportDialog::_script_export_mode_changed(int p_mode) {
 	_update_current_preset();
 }
 
+void ProjectExportDialog::_compress_pck_changed(bool p_pressed) {
+	if (updating) {
+		return;
+	}
+
+	Ref<EditorExportPreset> current = get_current_preset();
+	ERR_FAIL_COND(current.is_null());
+
+	current->set_compress_pck(p_pressed);
+
+	_update_current_preset();
+}
+
 void ProjectExportDialog::_script_encryption_key_changed(const String &p_key) {
 	if (updating) {
 		return;
@@ -1114,6 +1129,12 @@ ProjectExportDialog::ProjectExportDialog() {
 	script_mode->add_item(TTR("Compiled"), (int)EditorExportPreset::MODE_SCRIPT_COMPILED);
 	script_mode->connect("item_selected", callable_mp(this, &ProjectExportDialog::_script_export_mode_changed));
 
+	compress_pck = memnew(CheckButton);
+	compress_pck->set_text(TTR("Compress exported PCK"));
+	compress_pck->set_tooltip(TTR("Files that compress well are stored compressed in the PCK, in blocks that are decompressed on demand."));
+	compress_pck->connect("toggled", callable_mp(this, &ProjectExportDialog::_compress_pck_changed));
+	resources_vb->add_child(compress_pck);
+
 	// Feature tags.
 
 	VBoxContainer *feature_vb = memnew(VBoxContainer);
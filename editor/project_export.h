@@ -95,6 +95,7 @@ private:
 	RichTextLabel *custom_feature_display;
 
 	OptionButton *script_mode;
+	CheckButton *compress_pck;
 	LineEdit *script_key;
 	Label *script_key_error;
 
@@ -161,6 +162,7 @@ private:
 	void _enc_directory_changed(bool p_pressed);
 	void _enc_filters_changed(const String &p_text);
 	void _script_export_mode_changed(int p_mode);
+	void _compress_pck_changed(bool p_pressed);
 	void _script_encryption_key_changed(const String &p_key);
 	bool _validate_script_encryption_key(const String &p_key);
 
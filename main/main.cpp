@@ -36,12 +36,14 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/input/input.h"
 #include "core/input/input_map.h"
+#include "core/io/async_file_io.h"
 #include "core/io/file_access_network.h"
 #include "core/io/file_access_pack.h"
 #include "core/io/file_access_zip.h"
 #include "core/io/image_loader.h"
 #include "core/io/ip.h"
 #include "core/io/resource_loader.h"
+#include "core/io/resource_streamer.h"
 #include "core/object/message_queue.h"
 #include "core/os/dir_access.h"
 #include "core/os/os.h"
@@ -2497,6 +2499,8 @@ bool Main::iteration() {
 	}
 	message_queue->flush();
 
+	ResourceStreamer::get_singleton()->update();
+
 	RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
 
 	if (DisplayServer::get_singleton()->can_any_window_draw() &&
@@ -2600,6 +2604,9 @@ void Main::cleanup(bool p_force) {
 
 	OS::get_singleton()->delete_main_loop();
 
+	ResourceStreamer::get_singleton()->clear();
+	AsyncFileIO::get_singleton()->finish(); // Completes the pending requests, writes included.
+
 	OS::get_singleton()->_cmdline.clear();
 	OS::get_singleton()->_execpath = "";
 	OS::get_singleton()->_local_clipboard = "";
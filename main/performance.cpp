@@ -30,10 +30,12 @@
 
 #include "performance.h"
 
+#include "core/io/resource_streamer.h"
 #include "core/object/message_queue.h"
 #include "core/os/os.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
+#include "scene/resources/packed_scene_pool.h"
 #include "servers/audio_server.h"
 #include "servers/physics_server_2d.h"
 #include "servers/physics_server_3d.h"
@@ -77,6 +79,14 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PHYSICS_3D_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_COUNT);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(RESOURCE_STREAMING_MEMORY);
+	BIND_ENUM_CONSTANT(RESOURCE_STREAMING_HITS);
+	BIND_ENUM_CONSTANT(RESOURCE_STREAMING_MISSES);
+	BIND_ENUM_CONSTANT(RESOURCE_STREAMING_EVICTIONS);
+	BIND_ENUM_CONSTANT(SCENE_POOL_HITS);
+	BIND_ENUM_CONSTANT(SCENE_POOL_MISSES);
+	BIND_ENUM_CONSTANT(GUI_LAYOUT_SORTS);
+	BIND_ENUM_CONSTANT(GUI_LAYOUT_TIME);
 
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
@@ -90,6 +100,22 @@ float Performance::_get_node_count() const {
 	return sml->get_node_count();
 }
 
+float Performance::_get_layout_sort_count() const {
+	SceneTree *sml = Object::cast_to<SceneTree>(OS::get_singleton()->get_main_loop());
+	if (!sml) {
+		return 0;
+	}
+	return sml->get_layout_sort_count();
+}
+
+float Performance::_get_layout_time() const {
+	SceneTree *sml = Object::cast_to<SceneTree>(OS::get_singleton()->get_main_loop());
+	if (!sml) {
+		return 0;
+	}
+	return sml->get_layout_time();
+}
+
 String Performance::get_monitor_name(Monitor p_monitor) const {
 	ERR_FAIL_INDEX_V(p_monitor, MONITOR_MAX, String());
 	static const char *names[MONITOR_MAX] = {
@@ -120,6 +146,14 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"physics_3d/collision_pairs",
 		"physics_3d/islands",
 		"audio/driver/output_latency",
+		"resource_streaming/memory",
+		"resource_streaming/hits",
+		"resource_streaming/misses",
+		"resource_streaming/evictions",
+		"scene_pool/hits",
+		"scene_pool/misses",
+		"gui/layout_sorts",
+		"gui/layout_time",
 
 	};
 
@@ -147,7 +181,7 @@ float Performance::get_monitor(Monitor p_monitor) const {
 		case OBJECT_NODE_COUNT:
 			return _get_node_count();
 		case OBJECT_ORPHAN_NODE_COUNT:
-			return Node::orphan_node_count;
+			return Node::orphan_node_count.get();
 		case RENDER_OBJECTS_IN_FRAME:
 			return RS::get_singleton()->get_render_info(RS::INFO_OBJECTS_IN_FRAME);
 		case RENDER_VERTICES_IN_FRAME:
@@ -182,6 +216,22 @@ float Performance::get_monitor(Monitor p_monitor) const {
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT);
 		case AUDIO_OUTPUT_LATENCY:
 			return AudioServer::get_singleton()->get_output_latency();
+		case RESOURCE_STREAMING_MEMORY:
+			return ResourceStreamer::get_singleton()->get_memory_usage();
+		case RESOURCE_STREAMING_HITS:
+			return ResourceStreamer::get_singleton()->get_hit_count();
+		case RESOURCE_STREAMING_MISSES:
+			return ResourceStreamer::get_singleton()->get_miss_count();
+		case RESOURCE_STREAMING_EVICTIONS:
+			return ResourceStreamer::get_singleton()->get_eviction_count();
+		case SCENE_POOL_HITS:
+			return PackedScenePool::get_total_hit_count();
+		case SCENE_POOL_MISSES:
+			return PackedScenePool::get_total_miss_count();
+		case GUI_LAYOUT_SORTS:
+			return _get_layout_sort_count();
+		case GUI_LAYOUT_TIME:
+			return _get_layout_time();
 
 		default: {
 		}
@@ -221,6 +271,14 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
 
 	};
 
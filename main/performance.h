@@ -44,6 +44,8 @@ class Performance : public Object {
 	static void _bind_methods();
 
 	float _get_node_count() const;
+	float _get_layout_sort_count() const;
+	float _get_layout_time() const;
 
 	float _process_time;
 	float _physics_process_time;
@@ -91,6 +93,14 @@ public:
 		PHYSICS_3D_ISLAND_COUNT,
 		//physics
 		AUDIO_OUTPUT_LATENCY,
+		RESOURCE_STREAMING_MEMORY,
+		RESOURCE_STREAMING_HITS,
+		RESOURCE_STREAMING_MISSES,
+		RESOURCE_STREAMING_EVICTIONS,
+		SCENE_POOL_HITS,
+		SCENE_POOL_MISSES,
+		GUI_LAYOUT_SORTS,
+		GUI_LAYOUT_TIME,
 		MONITOR_MAX
 	};
 
@@ -43,6 +43,7 @@
 #include "gdscript_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_warning.h"
 
 ///////////////////////////
@@ -1758,6 +1759,23 @@ void GDScriptLanguage::init() {
 	for (List<Engine::Singleton>::Element *E = singletons.front(); E; E = E->next()) {
 		_add_global(E->get().name, E->get().ptr);
 	}
+
+	// Parse named classes up front in parallel, so the analyzer finds them ready when resolving dependencies.
+	// The global class list is only loaded by now, and parsers left unused are dropped on the first frame.
+	if (GLOBAL_GET("gdscript/cache/parse_global_classes_on_startup") && !Engine::get_singleton()->is_editor_hint()) {
+		Vector<String> paths;
+		List<StringName> global_classes;
+		ScriptServer::get_global_class_list(&global_classes);
+		for (List<StringName>::Element *E = global_classes.front(); E; E = E->next()) {
+			if (ScriptServer::get_global_class_language(E->get()) == get_name()) {
+				paths.push_back(ScriptServer::get_global_class_path(E->get()));
+			}
+		}
+		if (!paths.is_empty()) {
+			GDScriptCache::warm_up(paths);
+			cache_warm_up_pending = true;
+		}
+	}
 }
 
 String GDScriptLanguage::get_type() const {
@@ -1774,6 +1792,12 @@ Error GDScriptLanguage::execute_file(const String &p_path) {
 }
 
 void GDScriptLanguage::finish() {
+	if (GDScriptSamplingProfiler::is_running()) {
+		GDScriptSamplingProfiler::stop();
+		GDScriptSamplingProfiler::save_folded_stacks(GLOBAL_GET("debug/gdscript/sampling_profiler/output_path"));
+	}
+	GDScriptSamplingProfiler::clear();
+	GDScriptStackPool::clear();
 }
 
 void GDScriptLanguage::profiling_start() {
@@ -2029,6 +2053,11 @@ void GDScriptLanguage::reload_tool_script(const Ref<Script> &p_script, bool p_so
 void GDScriptLanguage::frame() {
 	calls = 0;
 
+	if (cache_warm_up_pending) {
+		GDScriptCache::clear_warm_up();
+		cache_warm_up_pending = false;
+	}
+
 #ifdef DEBUG_ENABLED
 	if (profiling) {
 		MutexLock lock(this->lock);
@@ -2261,6 +2290,17 @@ GDScriptLanguage::GDScriptLanguage() {
 		GLOBAL_DEF("debug/gdscript/warnings/" + warning, default_enabled);
 	}
 #endif // DEBUG_ENABLED
+
+	// Unlike profiling_start(), sampling is also available in release builds.
+	GLOBAL_DEF("debug/gdscript/sampling_profiler/enabled", false);
+	GLOBAL_DEF("debug/gdscript/sampling_profiler/interval_usec", 1000);
+	ProjectSettings::get_singleton()->set_custom_property_info("debug/gdscript/sampling_profiler/interval_usec", PropertyInfo(Variant::INT, "debug/gdscript/sampling_profiler/interval_usec", PROPERTY_HINT_RANGE, "100,100000,1,or_greater"));
+	GLOBAL_DEF("debug/gdscript/sampling_profiler/output_path", "user://gdscript_profile.folded");
+	if (GLOBAL_GET("debug/gdscript/sampling_profiler/enabled")) {
+		GDScriptSamplingProfiler::start(GLOBAL_GET("debug/gdscript/sampling_profiler/interval_usec"));
+	}
+
+	GLOBAL_DEF("gdscript/cache/parse_global_classes_on_startup", false);
 }
 
 GDScriptLanguage::~GDScriptLanguage() {
@@ -367,6 +367,8 @@ class GDScriptLanguage : public ScriptLanguage {
 
 	Map<String, ObjectID> orphan_subclasses;
 
+	bool cache_warm_up_pending = false;
+
 public:
 	int calls;
 
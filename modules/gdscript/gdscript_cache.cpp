@@ -31,6 +31,7 @@
 #include "gdscript_cache.h"
 
 #include "core/os/file_access.h"
+#include "core/templates/thread_work_pool.h"
 #include "core/templates/vector.h"
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
@@ -109,7 +110,11 @@ GDScriptParserRef::~GDScriptParserRef() {
 		memdelete(analyzer);
 	}
 	MutexLock lock(GDScriptCache::singleton->lock);
-	GDScriptCache::singleton->parser_map.erase(path);
+	// A parser discarded during warm-up may share its path with the registered one.
+	GDScriptParserRef **registered = GDScriptCache::singleton->parser_map.getptr(path);
+	if (registered && *registered == this) {
+		GDScriptCache::singleton->parser_map.erase(path);
+	}
 }
 
 GDScriptCache *GDScriptCache::singleton = nullptr;
@@ -118,6 +123,7 @@ void GDScriptCache::remove_script(const String &p_path) {
 	MutexLock lock(singleton->lock);
 	singleton->shallow_gdscript_cache.erase(p_path);
 	singleton->full_gdscript_cache.erase(p_path);
+	singleton->warm_parsers.erase(p_path);
 }
 
 Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptParserRef::Status p_status, Error &r_error, const String &p_owner) {
@@ -215,6 +221,7 @@ Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_erro
 
 	singleton->full_gdscript_cache[p_path] = script.ptr();
 	singleton->shallow_gdscript_cache.erase(p_path);
+	singleton->warm_parsers.erase(p_path);
 
 	return script;
 }
@@ -243,11 +250,63 @@ Error GDScriptCache::finish_compiling(const String &p_owner) {
 	return err;
 }
 
+void GDScriptCache::_warm_up_parse(uint32_t p_index, Ref<GDScriptParserRef> *p_refs) {
+	// Only parsing is done here, the analyzer needs other scripts and takes the cache lock.
+	p_refs[p_index]->raise_status(GDScriptParserRef::PARSED);
+}
+
+void GDScriptCache::warm_up(const Vector<String> &p_paths) {
+	Vector<Ref<GDScriptParserRef>> refs;
+	{
+		MutexLock lock(singleton->lock);
+		for (int i = 0; i < p_paths.size(); i++) {
+			const String &path = p_paths[i];
+			if (singleton->parser_map.has(path) || singleton->full_gdscript_cache.has(path) || !FileAccess::exists(path)) {
+				continue;
+			}
+			Ref<GDScriptParserRef> ref;
+			ref.instance();
+			ref->parser = memnew(GDScriptParser);
+			ref->path = path;
+			refs.push_back(ref);
+		}
+	}
+
+	if (refs.is_empty()) {
+		return;
+	}
+
+	// The builtin type table is filled lazily, do it before parsing from several threads.
+	GDScriptParser::get_builtin_type(StringName());
+
+	ThreadWorkPool work_pool;
+	work_pool.init();
+	work_pool.do_work(refs.size(), singleton, &GDScriptCache::_warm_up_parse, refs.ptrw());
+	work_pool.finish();
+
+	MutexLock lock(singleton->lock);
+	for (int i = 0; i < refs.size(); i++) {
+		Ref<GDScriptParserRef> ref = refs[i];
+		// Scripts that failed to parse report their errors once they are actually loaded.
+		if (!ref->is_valid() || singleton->parser_map.has(ref->path)) {
+			continue;
+		}
+		singleton->parser_map[ref->path] = ref.ptr();
+		singleton->warm_parsers[ref->path] = ref;
+	}
+}
+
+void GDScriptCache::clear_warm_up() {
+	MutexLock lock(singleton->lock);
+	singleton->warm_parsers.clear();
+}
+
 GDScriptCache::GDScriptCache() {
 	singleton = this;
 }
 
 GDScriptCache::~GDScriptCache() {
+	warm_parsers.clear();
 	parser_map.clear();
 	shallow_gdscript_cache.clear();
 	full_gdscript_cache.clear();
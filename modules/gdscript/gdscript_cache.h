@@ -74,6 +74,8 @@ class GDScriptCache {
 	HashMap<String, GDScript *> shallow_gdscript_cache;
 	HashMap<String, GDScript *> full_gdscript_cache;
 	HashMap<String, Set<String>> dependencies;
+	// Parsers created ahead of time by warm_up(), kept alive until the script is compiled.
+	HashMap<String, Ref<GDScriptParserRef>> warm_parsers;
 
 	friend class GDScript;
 	friend class GDScriptParserRef;
@@ -83,6 +85,8 @@ class GDScriptCache {
 	Mutex lock;
 	static void remove_script(const String &p_path);
 
+	void _warm_up_parse(uint32_t p_index, Ref<GDScriptParserRef> *p_refs);
+
 public:
 	static Ref<GDScriptParserRef> get_parser(const String &p_path, GDScriptParserRef::Status status, Error &r_error, const String &p_owner = String());
 	static String get_source_code(const String &p_path);
@@ -90,6 +94,9 @@ public:
 	static Ref<GDScript> get_full_script(const String &p_path, Error &r_error, const String &p_owner = String());
 	static Error finish_compiling(const String &p_owner);
 
+	static void warm_up(const Vector<String> &p_paths);
+	static void clear_warm_up();
+
 	GDScriptCache();
 	~GDScriptCache();
 };
@@ -273,6 +273,50 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 	return ret;
 }
 
+Mutex GDScriptStackPool::mutex;
+HashMap<uint32_t, LocalVector<Vector<uint8_t>>> GDScriptStackPool::pool;
+uint32_t GDScriptStackPool::pooled_bytes = 0;
+
+Vector<uint8_t> GDScriptStackPool::acquire(uint32_t p_size) {
+	{
+		MutexLock lock(mutex);
+		LocalVector<Vector<uint8_t>> *stacks = pool.getptr(p_size);
+		if (stacks && stacks->size()) {
+			Vector<uint8_t> stack = (*stacks)[stacks->size() - 1];
+			stacks->resize(stacks->size() - 1);
+			pooled_bytes -= p_size;
+			return stack;
+		}
+	}
+
+	Vector<uint8_t> stack;
+	stack.resize(p_size);
+	return stack;
+}
+
+void GDScriptStackPool::release(Vector<uint8_t> &p_stack) {
+	uint32_t size = p_stack.size();
+	if (size) {
+		MutexLock lock(mutex);
+		if (pooled_bytes + size <= MAX_BYTES) {
+			pool[size].push_back(p_stack);
+			pooled_bytes += size;
+		}
+	}
+	p_stack = Vector<uint8_t>();
+}
+
+uint32_t GDScriptStackPool::get_pooled_bytes() {
+	MutexLock lock(mutex);
+	return pooled_bytes;
+}
+
+void GDScriptStackPool::clear() {
+	MutexLock lock(mutex);
+	pool.clear();
+	pooled_bytes = 0;
+}
+
 void GDScriptFunctionState::_clear_stack() {
 	if (state.stack_size) {
 		Variant *stack = (Variant *)state.stack.ptr();
@@ -298,6 +342,7 @@ GDScriptFunctionState::GDScriptFunctionState() :
 
 GDScriptFunctionState::~GDScriptFunctionState() {
 	_clear_stack();
+	GDScriptStackPool::release(state.stack);
 
 	{
 		MutexLock lock(GDScriptLanguage::singleton->lock);
@@ -33,8 +33,11 @@
 
 #include "core/object/reference.h"
 #include "core/object/script_language.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
@@ -485,6 +488,24 @@ public:
 	~GDScriptFunction();
 };
 
+// Stack buffers of finished function states, reused by the next await of a function with the same
+// stack size. The pool is capped in bytes, so a burst of awaits doesn't keep its memory pinned.
+class GDScriptStackPool {
+	static Mutex mutex;
+	static HashMap<uint32_t, LocalVector<Vector<uint8_t>>> pool;
+	static uint32_t pooled_bytes;
+
+public:
+	enum {
+		MAX_BYTES = 1024 * 1024,
+	};
+
+	static Vector<uint8_t> acquire(uint32_t p_size);
+	static void release(Vector<uint8_t> &p_stack);
+	static uint32_t get_pooled_bytes();
+	static void clear();
+};
+
 class GDScriptFunctionState : public Reference {
 	GDCLASS(GDScriptFunctionState, Reference);
 	friend class GDScriptFunction;
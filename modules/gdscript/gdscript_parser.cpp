@@ -148,12 +148,32 @@ GDScriptParser::~GDScriptParser() {
 	clear();
 }
 
+void *GDScriptParser::_alloc_node_memory(uint32_t p_size) {
+	// Keep every node aligned as malloc would.
+	const uint32_t alignment = 16;
+	p_size = (p_size + alignment - 1) & ~(alignment - 1);
+
+	if (node_block_used + p_size > NODE_BLOCK_SIZE) {
+		node_blocks.push_back((uint8_t *)memalloc(MAX(p_size, (uint32_t)NODE_BLOCK_SIZE)));
+		node_block_used = 0;
+	}
+
+	void *memory = node_blocks[node_blocks.size() - 1] + node_block_used;
+	node_block_used += p_size;
+	return memory;
+}
+
 void GDScriptParser::clear() {
 	while (list != nullptr) {
 		Node *element = list;
 		list = list->next;
-		memdelete(element);
+		element->~Node();
+	}
+	for (uint32_t i = 0; i < node_blocks.size(); i++) {
+		memfree(node_blocks[i]);
 	}
+	node_blocks.clear();
+	node_block_used = NODE_BLOCK_SIZE;
 
 	head = nullptr;
 	list = nullptr;
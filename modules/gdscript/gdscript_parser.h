@@ -39,6 +39,7 @@
 #include "core/string/ustring.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/map.h"
 #include "core/templates/vector.h"
 #include "core/variant/variant.h"
@@ -1117,6 +1118,16 @@ private:
 	ClassNode *head = nullptr;
 	Node *list = nullptr;
 	List<ParserError> errors;
+
+	// Nodes are placed in large blocks owned by the parser instead of being allocated one by one.
+	// They are still linked in `list` so clear() can run their destructors.
+	enum {
+		NODE_BLOCK_SIZE = 16384,
+	};
+	LocalVector<uint8_t *> node_blocks;
+	uint32_t node_block_used = NODE_BLOCK_SIZE;
+	void *_alloc_node_memory(uint32_t p_size);
+
 #ifdef DEBUG_ENABLED
 	List<GDScriptWarning> warnings;
 	Set<String> ignored_warnings;
@@ -1192,7 +1203,7 @@ private:
 
 	template <class T>
 	T *alloc_node() {
-		T *node = memnew(T);
+		T *node = memnew_placement(_alloc_node_memory(sizeof(T)), T);
 
 		node->next = list;
 		list = node;
@@ -0,0 +1,142 @@
+/*************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#include "core/os/file_access.h"
+#include "core/os/os.h"
+#include "gdscript.h"
+#include "gdscript_function.h"
+
+thread_local GDScriptSamplingProfiler::Frame *GDScriptSamplingProfiler::current_frame = nullptr;
+std::atomic<bool> GDScriptSamplingProfiler::sample_requested(false);
+Mutex GDScriptSamplingProfiler::mutex;
+GDScriptSamplingProfiler *GDScriptSamplingProfiler::singleton = nullptr;
+
+void GDScriptSamplingProfiler::_thread_func(void *p_user) {
+	GDScriptSamplingProfiler *profiler = (GDScriptSamplingProfiler *)p_user;
+	while (!profiler->exit_thread.is_set()) {
+		OS::get_singleton()->delay_usec(profiler->interval_usec);
+		sample_requested.store(true, std::memory_order_relaxed);
+	}
+}
+
+void GDScriptSamplingProfiler::_take_sample() {
+	// Only the thread that sees the request first records its stack.
+	if (!sample_requested.exchange(false)) {
+		return;
+	}
+
+	String stack;
+	for (const Frame *frame = current_frame; frame; frame = frame->parent) {
+		const GDScriptFunction *function = frame->function;
+		String name = function->get_script() ? function->get_script()->get_path() + ":" : String();
+		name += function->get_name();
+		stack = stack.is_empty() ? name : name + ";" + stack;
+	}
+
+	MutexLock lock(mutex);
+	if (!singleton) {
+		return;
+	}
+	uint64_t *count = singleton->folded_stacks.getptr(stack);
+	if (count) {
+		(*count)++;
+	} else {
+		singleton->folded_stacks[stack] = 1;
+	}
+	singleton->sample_count++;
+}
+
+bool GDScriptSamplingProfiler::is_running() {
+	MutexLock lock(mutex);
+	return singleton && singleton->thread.is_started();
+}
+
+void GDScriptSamplingProfiler::start(uint32_t p_interval_usec) {
+	MutexLock lock(mutex);
+	if (!singleton) {
+		singleton = memnew(GDScriptSamplingProfiler);
+	}
+	ERR_FAIL_COND_MSG(singleton->thread.is_started(), "The GDScript sampling profiler is already running.");
+
+	singleton->interval_usec = MAX(p_interval_usec, 100u);
+	singleton->exit_thread.clear();
+	singleton->thread.start(_thread_func, singleton);
+}
+
+void GDScriptSamplingProfiler::stop() {
+	MutexLock lock(mutex);
+	if (!singleton || !singleton->thread.is_started()) {
+		return;
+	}
+	singleton->exit_thread.set();
+	singleton->thread.wait_to_finish();
+	sample_requested.store(false);
+}
+
+void GDScriptSamplingProfiler::clear() {
+	stop();
+	MutexLock lock(mutex);
+	if (singleton) {
+		memdelete(singleton);
+		singleton = nullptr;
+	}
+}
+
+uint64_t GDScriptSamplingProfiler::get_sample_count() {
+	MutexLock lock(mutex);
+	return singleton ? singleton->sample_count : 0;
+}
+
+String GDScriptSamplingProfiler::get_folded_stacks() {
+	MutexLock lock(mutex);
+	if (!singleton) {
+		return String();
+	}
+
+	String result;
+	const String *key = nullptr;
+	while ((key = singleton->folded_stacks.next(key))) {
+		result += *key + " " + itos(singleton->folded_stacks[*key]) + "\n";
+	}
+	return result;
+}
+
+Error GDScriptSamplingProfiler::save_folded_stacks(const String &p_path) {
+	String folded = get_folded_stacks();
+
+	Error err;
+	FileAccessRef f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Can't save GDScript profile to '" + p_path + "'.");
+	f->store_string(folded);
+	f->close();
+	return OK;
+}
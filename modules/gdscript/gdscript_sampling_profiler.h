@@ -0,0 +1,96 @@
+/*************************************************************************/
+/*  gdscript_sampling_profiler.h                                         */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GDSCRIPT_SAMPLING_PROFILER_H
+#define GDSCRIPT_SAMPLING_PROFILER_H
+
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/safe_refcount.h"
+
+#include <atomic>
+
+class GDScriptFunction;
+
+// Statistical profiler meant to stay enabled in production builds.
+// Every running GDScriptFunction links a Frame on the native stack of its thread. A timer thread
+// periodically raises a flag, and the next function entered on any thread walks its own frame
+// chain and records it, so no thread ever reads the stack of another one.
+class GDScriptSamplingProfiler {
+public:
+	struct Frame {
+		const GDScriptFunction *function = nullptr;
+		Frame *parent = nullptr;
+	};
+
+private:
+	static thread_local Frame *current_frame;
+	static std::atomic<bool> sample_requested;
+	static Mutex mutex;
+	static GDScriptSamplingProfiler *singleton;
+
+	Thread thread;
+	SafeFlag exit_thread;
+	uint32_t interval_usec = 1000;
+
+	HashMap<String, uint64_t> folded_stacks;
+	uint64_t sample_count = 0;
+
+	static void _thread_func(void *p_user);
+	static void _take_sample();
+
+public:
+	_FORCE_INLINE_ static void push_frame(Frame *p_frame, const GDScriptFunction *p_function) {
+		p_frame->function = p_function;
+		p_frame->parent = current_frame;
+		current_frame = p_frame;
+		if (unlikely(sample_requested.load(std::memory_order_relaxed))) {
+			_take_sample();
+		}
+	}
+
+	_FORCE_INLINE_ static void pop_frame(Frame *p_frame) {
+		current_frame = p_frame->parent;
+	}
+
+	static bool is_running();
+	static void start(uint32_t p_interval_usec);
+	static void stop();
+	// Frees the collected samples.
+	static void clear();
+
+	static uint64_t get_sample_count();
+	// Returns the samples as "root;caller;callee count" lines, as used by flame graph tools.
+	static String get_folded_stacks();
+	static Error save_folded_stacks(const String &p_path);
+};
+
+#endif // GDSCRIPT_SAMPLING_PROFILER_H
@@ -318,6 +318,16 @@ static bool _is_binary_digit(char32_t c) {
 	return (c == '0' || c == '1');
 }
 
+// Compares source code with an ASCII word without building a String out of it.
+static bool _source_matches(const char32_t *p_source, const char *p_word, int p_length) {
+	for (int i = 0; i < p_length; i++) {
+		if (p_source[i] != (char32_t)p_word[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
 GDScriptTokenizer::Token GDScriptTokenizer::make_token(Token::Type p_type) {
 	Token token(p_type);
 	token.start_line = start_line;
@@ -326,7 +336,8 @@ GDScriptTokenizer::Token GDScriptTokenizer::make_token(Token::Type p_type) {
 	token.end_column = column;
 	token.leftmost_column = leftmost_column;
 	token.rightmost_column = rightmost_column;
-	token.source = String(_start, _current - _start);
+	token.source = _start;
+	token.source_length = _current - _start;
 
 	if (p_type != Token::ERROR && cursor_line > -1) {
 		// Also count whitespace after token.
@@ -446,7 +457,7 @@ GDScriptTokenizer::Token GDScriptTokenizer::annotation() {
 		_advance();
 	}
 	Token annotation = make_token(Token::ANNOTATION);
-	annotation.literal = StringName(annotation.source);
+	annotation.literal = StringName(annotation.get_source());
 	return annotation;
 }
 
@@ -527,10 +538,9 @@ GDScriptTokenizer::Token GDScriptTokenizer::potential_identifier() {
 		return make_token(Token::UNDERSCORE);
 	}
 
-	String name(_start, length);
 	if (length < MIN_KEYWORD_LENGTH || length > MAX_KEYWORD_LENGTH) {
 		// Cannot be a keyword, as the length doesn't match any.
-		return make_identifier(name);
+		return make_identifier(String(_start, length));
 	}
 
 	// Define some helper macros for the switch case.
@@ -542,7 +552,7 @@ GDScriptTokenizer::Token GDScriptTokenizer::potential_identifier() {
 		const int keyword_length = sizeof(keyword) - 1;                                                                   \
 		static_assert(keyword_length <= MAX_KEYWORD_LENGTH, "There's a keyword longer than the defined maximum length");  \
 		static_assert(keyword_length >= MIN_KEYWORD_LENGTH, "There's a keyword shorter than the defined minimum length"); \
-		if (keyword_length == length && name == keyword) {                                                                \
+		if (keyword_length == length && _source_matches(_start, keyword, keyword_length)) {                               \
 			return make_token(token_type);                                                                                \
 		}                                                                                                                 \
 	}
@@ -556,19 +566,19 @@ GDScriptTokenizer::Token GDScriptTokenizer::potential_identifier() {
 
 	// Check if it's a special literal
 	if (length == 4) {
-		if (name == "true") {
+		if (_source_matches(_start, "true", 4)) {
 			return make_literal(true);
-		} else if (name == "null") {
+		} else if (_source_matches(_start, "null", 4)) {
 			return make_literal(Variant());
 		}
 	} else if (length == 5) {
-		if (name == "false") {
+		if (_source_matches(_start, "false", 5)) {
 			return make_literal(false);
 		}
 	}
 
 	// Not a keyword, so must be an identifier.
-	return make_identifier(name);
+	return make_identifier(String(_start, length));
 
 #undef KEYWORDS
 #undef MIN_KEYWORD_LENGTH
@@ -166,12 +166,15 @@ public:
 		int leftmost_column = 0, rightmost_column = 0; // Column span for multiline tokens.
 		int cursor_position = -1;
 		CursorPlace cursor_place = CURSOR_NONE;
-		String source;
+		// Points into the source code of the tokenizer, so tokens don't need an allocation each.
+		const char32_t *source = nullptr;
+		int source_length = 0;
 
 		const char *get_name() const;
 		bool is_identifier() const;
 		bool is_node_name() const;
-		StringName get_identifier() const { return source; }
+		String get_source() const { return String(source, source_length); }
+		StringName get_identifier() const { return type == IDENTIFIER ? StringName(literal) : StringName(get_source()); }
 
 		Token(Type p_type) {
 			type = p_type;
@@ -33,6 +33,7 @@
 #include "core/core_string_names.h"
 #include "core/os/os.h"
 #include "gdscript.h"
+#include "gdscript_sampling_profiler.h"
 
 Variant *GDScriptFunction::_get_variant(int p_address, GDScriptInstance *p_instance, GDScript *p_script, Variant &self, Variant &static_ref, Variant *p_stack, String &r_error) const {
 	int address = p_address & ADDR_MASK;
@@ -398,6 +399,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 
 	uint32_t alloca_size = 0;
+	bool stack_moved = false;
 	GDScript *script;
 	int ip = 0;
 	int line = _initial_line;
@@ -542,6 +544,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	bool awaited = false;
 #endif
 
+	GDScriptSamplingProfiler::Frame sampling_frame;
+	GDScriptSamplingProfiler::push_frame(&sampling_frame, this);
+
 #ifdef DEBUG_ENABLED
 	OPCODE_WHILE(ip < _code_size) {
 		int last_opcode = _code_ptr[ip];
@@ -1945,11 +1950,20 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Ref<GDScriptFunctionState> gdfs = memnew(GDScriptFunctionState);
 					gdfs->function = this;
 
-					gdfs->state.stack.resize(alloca_size);
-					//copy variant stack
-					for (int i = 0; i < _stack_size; i++) {
-						memnew_placement(&gdfs->state.stack.write[sizeof(Variant) * i], Variant(stack[i]));
+					if (p_state) {
+						// Resumed from a previous await, the stack already lives in its buffer: hand it over.
+						gdfs->state.stack = p_state->stack;
+						p_state->stack = Vector<uint8_t>();
+						p_state->stack_size = 0;
+					} else {
+						// Variants are relocatable (CowData already reallocates them in place), so move the
+						// stack with a single copy instead of copy-constructing and destroying each slot.
+						gdfs->state.stack = GDScriptStackPool::acquire(alloca_size);
+						if (_stack_size) {
+							memcpy(gdfs->state.stack.ptrw(), stack, sizeof(Variant) * _stack_size);
+						}
 					}
+					stack_moved = true;
 					gdfs->state.stack_size = _stack_size;
 					gdfs->state.self = self;
 					gdfs->state.alloca_size = alloca_size;
@@ -2883,6 +2897,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	}
 
 	OPCODES_OUT
+	GDScriptSamplingProfiler::pop_frame(&sampling_frame);
+
 #ifdef DEBUG_ENABLED
 	if (GDScriptLanguage::get_singleton()->profiling) {
 		uint64_t time_taken = OS::get_singleton()->get_ticks_usec() - function_start_time;
@@ -2903,7 +2919,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		}
 #endif
 
-		if (_stack_size) {
+		if (_stack_size && !stack_moved) {
 			//free stack
 			for (int i = 0; i < _stack_size; i++) {
 				stack[i].~Variant();
@@ -0,0 +1,107 @@
+/*************************************************************************/
+/*  test_gdscript_stack_pool.h                                           */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_GDSCRIPT_STACK_POOL_H
+#define TEST_GDSCRIPT_STACK_POOL_H
+
+#include "modules/gdscript/gdscript_function.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGDScriptStackPool {
+
+TEST_CASE("[GDScript] Stack pool hands a finished stack to the next await") {
+	GDScriptStackPool::clear();
+
+	const int stack_size = 4;
+	const uint32_t alloca_size = sizeof(Variant) * stack_size;
+
+	Vector<uint8_t> stack = GDScriptStackPool::acquire(alloca_size);
+	REQUIRE(stack.size() == (int)alloca_size);
+	const uint8_t *buffer = stack.ptr();
+
+	// Fill and clear the stack the way the VM does for a suspended function that finishes.
+	Variant *variants = (Variant *)stack.ptrw();
+	for (int i = 0; i < stack_size; i++) {
+		memnew_placement(&variants[i], Variant(i));
+	}
+	for (int i = 0; i < stack_size; i++) {
+		variants[i].~Variant();
+	}
+	GDScriptStackPool::release(stack);
+	CHECK(stack.is_empty());
+	CHECK(GDScriptStackPool::get_pooled_bytes() == alloca_size);
+
+	Vector<uint8_t> resumed = GDScriptStackPool::acquire(alloca_size);
+	CHECK_MESSAGE(resumed.ptr() == buffer, "The pooled buffer should be reused.");
+	CHECK(GDScriptStackPool::get_pooled_bytes() == 0);
+
+	variants = (Variant *)resumed.ptrw();
+	for (int i = 0; i < stack_size; i++) {
+		memnew_placement(&variants[i], Variant(String::num_int64(i)));
+	}
+	for (int i = 0; i < stack_size; i++) {
+		CHECK(variants[i] == Variant(String::num_int64(i)));
+		variants[i].~Variant();
+	}
+
+	// A stack of another size doesn't take the pooled one.
+	GDScriptStackPool::release(resumed);
+	Vector<uint8_t> other = GDScriptStackPool::acquire(alloca_size * 2);
+	CHECK(other.size() == (int)alloca_size * 2);
+	CHECK(GDScriptStackPool::get_pooled_bytes() == alloca_size);
+
+	GDScriptStackPool::clear();
+	CHECK(GDScriptStackPool::get_pooled_bytes() == 0);
+}
+
+TEST_CASE("[GDScript] Stack pool doesn't keep more than its byte budget") {
+	GDScriptStackPool::clear();
+
+	const uint32_t alloca_size = 64 * 1024;
+	const int count = GDScriptStackPool::MAX_BYTES / alloca_size + 4;
+
+	Vector<Vector<uint8_t>> stacks;
+	for (int i = 0; i < count; i++) {
+		stacks.push_back(GDScriptStackPool::acquire(alloca_size));
+	}
+	for (int i = 0; i < count; i++) {
+		GDScriptStackPool::release(stacks.write[i]);
+	}
+
+	CHECK(GDScriptStackPool::get_pooled_bytes() <= (uint32_t)GDScriptStackPool::MAX_BYTES);
+	CHECK(GDScriptStackPool::get_pooled_bytes() == GDScriptStackPool::MAX_BYTES / alloca_size * alloca_size);
+
+	GDScriptStackPool::clear();
+}
+
+} // namespace TestGDScriptStackPool
+
+#endif // TEST_GDSCRIPT_STACK_POOL_H
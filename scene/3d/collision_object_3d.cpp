@@ -59,7 +59,7 @@ void CollisionObject3D::_notification(int p_what) {
 			if (area) {
 				PhysicsServer3D::get_singleton()->area_set_transform(rid, get_global_transform());
 			} else {
-				PhysicsServer3D::get_singleton()->body_set_state(rid, PhysicsServer3D::BODY_STATE_TRANSFORM, get_global_transform());
+				get_tree()->set_body_transform(rid, get_global_transform());
 			}
 
 		} break;
@@ -71,6 +71,7 @@ void CollisionObject3D::_notification(int p_what) {
 			if (area) {
 				PhysicsServer3D::get_singleton()->area_set_space(rid, RID());
 			} else {
+				get_tree()->cancel_body_transform(rid);
 				PhysicsServer3D::get_singleton()->body_set_space(rid, RID());
 			}
 
@@ -90,23 +90,27 @@ void Node3D::_update_local_transform() const {
 	data.dirty &= ~DIRTY_LOCAL;
 }
 
-void Node3D::_propagate_transform_changed(Node3D *p_origin) {
+bool Node3D::_propagate_transform_changed(Node3D *p_origin) {
 	if (!is_inside_tree()) {
-		return;
+		return false;
 	}
 
-	/*
-	if (data.dirty&DIRTY_GLOBAL)
-		return; //already dirty
-	*/
+	if (data.dirty & DIRTY_PROPAGATED) {
+		return true; // Moved again before anything read the result, nothing new to notify below.
+	}
 
 	data.children_lock++;
 
+	// Nodes ignoring notifications are not queued, so they must be visited again next time.
+	bool propagated = !data.ignore_notification;
+
 	for (List<Node3D *>::Element *E = data.children.front(); E; E = E->next()) {
 		if (E->get()->data.top_level_active) {
 			continue; //don't propagate to a top_level
 		}
-		E->get()->_propagate_transform_changed(p_origin);
+		if (!E->get()->_propagate_transform_changed(p_origin)) {
+			propagated = false;
+		}
 	}
 #ifdef TOOLS_ENABLED
 	if ((data.gizmo.is_valid() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
@@ -116,8 +120,25 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		get_tree()->xform_change_list.add(&xform_change);
 	}
 	data.dirty |= DIRTY_GLOBAL;
+	if (propagated) {
+		data.dirty |= DIRTY_PROPAGATED;
+	}
 
 	data.children_lock--;
+
+	return propagated;
+}
+
+void Node3D::_clear_propagated() {
+	// Parents can only be marked if all their children are, so stop at the first unmarked node.
+	Node3D *node = this;
+	while (node && (node->data.dirty & DIRTY_PROPAGATED)) {
+		node->data.dirty &= ~DIRTY_PROPAGATED;
+		if (node->data.top_level_active) {
+			break;
+		}
+		node = node->data.parent;
+	}
 }
 
 void Node3D::_notification(int p_what) {
@@ -145,6 +166,11 @@ void Node3D::_notification(int p_what) {
 			}
 
 			data.dirty |= DIRTY_GLOBAL; //global is always dirty upon entering a scene
+			data.dirty &= ~DIRTY_PROPAGATED;
+			if (data.parent && !data.top_level_active) {
+				// The parent may have been marked before this node was added, its next move must reach it.
+				data.parent->_clear_propagated();
+			}
 			_notify_dirty();
 
 			notification(NOTIFICATION_ENTER_WORLD);
@@ -211,6 +237,8 @@ void Node3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
+			// No longer queued, so the next move must reach this node again.
+			_clear_propagated();
 #ifdef TOOLS_ENABLED
 			if (data.gizmo.is_valid()) {
 				data.gizmo->transform();
@@ -267,7 +295,7 @@ Transform Node3D::get_global_transform() const {
 			data.global_transform.basis.orthonormalize();
 		}
 
-		data.dirty &= ~DIRTY_GLOBAL;
+		data.dirty &= ~(DIRTY_GLOBAL | DIRTY_PROPAGATED);
 	}
 
 	return data.global_transform;
@@ -400,6 +428,7 @@ void Node3D::set_gizmo(const Ref<Node3DGizmo> &p_gizmo) {
 		data.gizmo->free();
 	}
 	data.gizmo = p_gizmo;
+	_clear_propagated();
 	if (data.gizmo.is_valid() && is_inside_world()) {
 		data.gizmo->create();
 		if (is_visible_in_tree()) {
@@ -468,6 +497,9 @@ void Node3D::set_as_top_level(bool p_enabled) {
 
 		data.top_level = p_enabled;
 		data.top_level_active = p_enabled;
+		if (!p_enabled && data.parent) {
+			data.parent->_clear_propagated();
+		}
 
 	} else {
 		data.top_level = p_enabled;
@@ -668,6 +700,7 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 
 void Node3D::set_notify_transform(bool p_enable) {
 	data.notify_transform = p_enable;
+	_clear_propagated();
 }
 
 bool Node3D::is_transform_notification_enabled() const {
@@ -56,7 +56,10 @@ class Node3D : public Node {
 		DIRTY_NONE = 0,
 		DIRTY_VECTORS = 1,
 		DIRTY_LOCAL = 2,
-		DIRTY_GLOBAL = 4
+		DIRTY_GLOBAL = 4,
+		// Every node the transform propagates to from here is already DIRTY_GLOBAL and queued for
+		// NOTIFICATION_TRANSFORM_CHANGED if it wants it, so propagating again can stop at this node.
+		DIRTY_PROPAGATED = 8
 	};
 
 	mutable SelfList<Node> xform_change;
@@ -97,7 +100,8 @@ class Node3D : public Node {
 
 	void _update_gizmo();
 	void _notify_dirty();
-	void _propagate_transform_changed(Node3D *p_origin);
+	bool _propagate_transform_changed(Node3D *p_origin);
+	void _clear_propagated();
 
 	void _propagate_visibility_changed();
 
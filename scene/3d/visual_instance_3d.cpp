@@ -61,10 +61,10 @@ void VisualInstance3D::_notification(int p_what) {
 
 		} break;
 		case NOTIFICATION_TRANSFORM_CHANGED: {
-			Transform gt = get_global_transform();
-			RenderingServer::get_singleton()->instance_set_transform(instance, gt);
+			get_tree()->set_instance_transform(instance, get_global_transform());
 		} break;
 		case NOTIFICATION_EXIT_WORLD: {
+			get_tree()->cancel_instance_transform(instance);
 			RenderingServer::get_singleton()->instance_set_scenario(instance, RID());
 			RenderingServer::get_singleton()->instance_attach_skeleton(instance, RID());
 			//RS::get_singleton()->instance_geometry_set_baked_light_sampler(instance, RID() );
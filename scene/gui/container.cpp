@@ -29,7 +29,6 @@
 /*************************************************************************/
 
 #include "container.h"
-#include "core/object/message_queue.h"
 #include "scene/scene_string_names.h"
 
 void Container::_child_minsize_changed() {
@@ -135,7 +134,7 @@ void Container::queue_sort() {
 		return;
 	}
 
-	MessageQueue::get_singleton()->push_callable(callable_mp(this, &Container::_sort_children));
+	get_tree()->_queue_layout(get_instance_id(), true);
 	pending_sort = true;
 }
 
@@ -40,6 +40,8 @@ class Container : public Control {
 	void _sort_children();
 	void _child_minsize_changed();
 
+	friend class SceneTree;
+
 protected:
 	void queue_sort();
 	virtual void add_child_notify(Node *p_child) override;
@@ -32,7 +32,6 @@
 
 #include "core/config/project_settings.h"
 #include "core/math/geometry_2d.h"
-#include "core/object/message_queue.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
@@ -654,6 +653,10 @@ bool Control::clips_input() const {
 	return false;
 }
 
+bool Control::is_hit_test_bounded() const {
+	return !get_script_instance() || !get_script_instance()->has_method(SceneStringNames::get_singleton()->has_point);
+}
+
 bool Control::has_point(const Point2 &p_point) const {
 	if (get_script_instance()) {
 		Variant v = p_point;
@@ -2436,7 +2439,7 @@ void Control::minimum_size_changed() {
 
 	data.updating_last_minimum_size = true;
 
-	MessageQueue::get_singleton()->push_call(this, "_update_minimum_size");
+	get_tree()->_queue_layout(get_instance_id(), false);
 }
 
 int Control::get_v_size_flags() const {
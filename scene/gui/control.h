@@ -252,6 +252,7 @@ private:
 	Transform2D _get_internal_transform() const;
 
 	friend class Viewport;
+	friend class SceneTree;
 
 	void _update_minimum_size_cache();
 	friend class Window;
@@ -341,6 +342,8 @@ public:
 	virtual Size2 get_minimum_size() const;
 	virtual Size2 get_combined_minimum_size() const;
 	virtual bool has_point(const Point2 &p_point) const;
+	// False when has_point() may accept points outside of the rect, so picking can't skip the control by its bounds.
+	virtual bool is_hit_test_bounded() const;
 	virtual bool clips_input() const;
 	virtual void set_drag_forwarding(Control *p_target);
 	virtual Variant get_drag_data(const Point2 &p_point);
@@ -48,6 +48,7 @@ class GraphEditFilter : public Control {
 	friend class GraphEditMinimap;
 	GraphEdit *ge;
 	virtual bool has_point(const Point2 &p_point) const override;
+	virtual bool is_hit_test_bounded() const override { return false; } // Ports stick out of the graph nodes.
 
 public:
 	GraphEditFilter(GraphEdit *p_edit);
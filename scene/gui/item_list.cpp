@@ -36,6 +36,9 @@
 void ItemList::_shape(int p_idx) {
 	Item &item = items.write[p_idx];
 
+	if (item.text_buf.is_null()) {
+		item.text_buf.instance();
+	}
 	item.text_buf->clear();
 	if (item.text_direction == Control::TEXT_DIRECTION_INHERITED) {
 		item.text_buf->set_direction(is_layout_rtl() ? TextServer::DIRECTION_RTL : TextServer::DIRECTION_LTR);
@@ -398,10 +401,102 @@ void ItemList::move_item(int p_from_idx, int p_to_idx) {
 	shape_changed = true;
 }
 
+void ItemList::set_item_count(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+	int old_count = items.size();
+	if (old_count == p_count) {
+		return;
+	}
+
+	items.resize(p_count);
+	bool virtual_items = !item_source.is_null();
+	Item *items_ptr = items.ptrw();
+	for (int i = old_count; i < p_count; i++) {
+		Item &item = items_ptr[i];
+		item.icon_modulate = Color(1, 1, 1, 1);
+		item.selectable = true;
+		item.tooltip_enabled = true;
+		item.custom_bg = Color(0, 0, 0, 0);
+		item.pending_fetch = virtual_items;
+		if (!virtual_items) {
+			item.text_buf.instance();
+		}
+	}
+
+	if (current >= p_count) {
+		current = -1;
+	}
+	update();
+	shape_changed = true;
+	defer_select_single = -1;
+}
+
 int ItemList::get_item_count() const {
 	return items.size();
 }
 
+void ItemList::set_item_source(const Callable &p_source) {
+	item_source = p_source;
+
+	bool virtual_items = !item_source.is_null();
+	for (int i = 0; i < items.size(); i++) {
+		Item &item = items.write[i];
+		item.pending_fetch = virtual_items;
+		if (virtual_items) {
+			item.text_buf.unref();
+		} else if (item.text_buf.is_null()) {
+			_shape(i);
+		}
+	}
+	update();
+	shape_changed = true;
+}
+
+Callable ItemList::get_item_source() const {
+	return item_source;
+}
+
+void ItemList::_fetch_item(int p_idx) {
+	items.write[p_idx].pending_fetch = false;
+
+	Variant index = p_idx;
+	const Variant *args[1] = { &index };
+	Variant ret;
+	Callable::CallError ce;
+	item_source.call(args, 1, ret, ce);
+	if (ce.error != Callable::CallError::CALL_OK) {
+		ERR_PRINT("Error calling ItemList item source: " + Variant::get_callable_error_text(item_source, args, 1, ce) + ".");
+		ret = Variant();
+	}
+	// The source may have removed the item while it was called.
+	if (p_idx >= items.size()) {
+		return;
+	}
+
+	Item &item = items.write[p_idx];
+	if (ret.get_type() == Variant::DICTIONARY) {
+		Dictionary d = ret;
+		item.text = d.get("text", String());
+		item.icon = Ref<Texture2D>(d.get("icon", Variant()));
+		item.tooltip = d.get("tooltip", String());
+		item.metadata = d.get("metadata", Variant());
+		item.disabled = d.get("disabled", false);
+		item.selectable = d.get("selectable", true);
+	} else {
+		item.text = ret;
+	}
+	_shape(p_idx);
+}
+
+float ItemList::_get_virtual_item_height() const {
+	float text_height = get_theme_font("font")->get_height(get_theme_font_size("font_size"));
+	float icon_height = fixed_icon_size.y * icon_scale;
+	if (icon_mode == ICON_MODE_TOP) {
+		return icon_height + (icon_height > 0 ? get_theme_constant("icon_margin") : 0) + (text_height + get_theme_constant("line_separation")) * max_text_lines;
+	}
+	return MAX(icon_height, text_height);
+}
+
 void ItemList::remove_item(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, items.size());
 
@@ -446,6 +541,9 @@ void ItemList::set_max_text_lines(int p_lines) {
 	if (max_text_lines != p_lines) {
 		max_text_lines = p_lines;
 		for (int i = 0; i < items.size(); i++) {
+			if (items[i].text_buf.is_null()) {
+				continue; // Not fetched yet, shaped with the current flags when it is.
+			}
 			if (icon_mode == ICON_MODE_TOP && max_text_lines > 0) {
 				items.write[i].text_buf->set_flags(TextServer::BREAK_MANDATORY | TextServer::BREAK_WORD_BOUND | TextServer::BREAK_GRAPHEME_BOUND);
 			} else {
@@ -486,6 +584,9 @@ void ItemList::set_icon_mode(IconMode p_mode) {
 	if (icon_mode != p_mode) {
 		icon_mode = p_mode;
 		for (int i = 0; i < items.size(); i++) {
+			if (items[i].text_buf.is_null()) {
+				continue; // Not fetched yet, shaped with the current flags when it is.
+			}
 			if (icon_mode == ICON_MODE_TOP && max_text_lines > 0) {
 				items.write[i].text_buf->set_flags(TextServer::BREAK_MANDATORY | TextServer::BREAK_WORD_BOUND | TextServer::BREAK_GRAPHEME_BOUND);
 			} else {
@@ -831,6 +932,27 @@ void ItemList::ensure_current_is_visible() {
 	update();
 }
 
+void ItemList::_update_scroll_bar(float p_content_height) {
+	Ref<StyleBox> bg = get_theme_stylebox("bg");
+	float page = MAX(0, get_size().height - bg->get_minimum_size().height);
+	float max = MAX(page, p_content_height);
+	if (auto_height) {
+		auto_height_value = p_content_height + bg->get_minimum_size().height;
+	}
+	scroll_bar->set_max(max);
+	scroll_bar->set_page(page);
+	if (max <= page) {
+		scroll_bar->set_value(0);
+		scroll_bar->hide();
+	} else {
+		scroll_bar->show();
+
+		if (do_autoscroll_to_bottom) {
+			scroll_bar->set_value(max);
+		}
+	}
+}
+
 static Rect2 _adjust_to_max_size(Size2 p_size, Size2 p_max_size) {
 	Size2 size = p_max_size;
 	int tex_width = p_size.width * size.height / p_size.height;
@@ -855,7 +977,9 @@ void ItemList::_notification(int p_what) {
 
 	if ((p_what == NOTIFICATION_LAYOUT_DIRECTION_CHANGED) || (p_what == NOTIFICATION_TRANSLATION_CHANGED) || (p_what == NOTIFICATION_THEME_CHANGED)) {
 		for (int i = 0; i < items.size(); i++) {
-			_shape(i);
+			if (!items[i].pending_fetch) {
+				_shape(i);
+			}
 		}
 		shape_changed = true;
 		update();
@@ -900,6 +1024,30 @@ void ItemList::_notification(int p_what) {
 			RenderingServer::get_singleton()->canvas_item_add_clip_ignore(get_canvas_item(), false);
 		}
 
+		if (shape_changed && !item_source.is_null()) {
+			// Items are laid out on a single column with the same height, so nothing is measured
+			// and items that aren't drawn are never fetched.
+			float item_height = _get_virtual_item_height() + vseparation;
+			float item_width = (fixed_column_width > 0 ? fixed_column_width : size.x - bg->get_minimum_size().width - mw) + hseparation;
+			current_columns = 1;
+			separators.resize(MAX(items.size() - 1, 0));
+
+			Item *items_ptr = items.ptrw();
+			int *separators_ptr = separators.ptrw();
+			for (int i = 0; i < items.size(); i++) {
+				float y = i * (item_height + vseparation);
+				items_ptr[i].rect_cache = Rect2(0, y, item_width, item_height);
+				items_ptr[i].min_rect_cache = items_ptr[i].rect_cache;
+				if (i < items.size() - 1) {
+					separators_ptr[i] = y + item_height + vseparation / 2;
+				}
+			}
+
+			_update_scroll_bar(items.size() * (item_height + vseparation));
+			minimum_size_changed();
+			shape_changed = false;
+		}
+
 		if (shape_changed) {
 			float max_column_width = 0.0;
 
@@ -1003,23 +1151,7 @@ void ItemList::_notification(int p_what) {
 				}
 
 				if (all_fit) {
-					float page = MAX(0, size.height - bg->get_minimum_size().height);
-					float max = MAX(page, ofs.y + max_h);
-					if (auto_height) {
-						auto_height_value = ofs.y + max_h + bg->get_minimum_size().height;
-					}
-					scroll_bar->set_max(max);
-					scroll_bar->set_page(page);
-					if (max <= page) {
-						scroll_bar->set_value(0);
-						scroll_bar->hide();
-					} else {
-						scroll_bar->show();
-
-						if (do_autoscroll_to_bottom) {
-							scroll_bar->set_value(max);
-						}
-					}
+					_update_scroll_bar(ofs.y + max_h);
 					break;
 				}
 			}
@@ -1080,6 +1212,15 @@ void ItemList::_notification(int p_what) {
 				continue;
 			}
 
+			if (items[i].pending_fetch) {
+				_fetch_item(i);
+				if (shape_changed) {
+					// The source changed the list, lay it out again. update() is ignored while drawing.
+					call_deferred("update");
+					break;
+				}
+			}
+
 			if (current_columns == 1) {
 				rcache.size.width = width - rcache.position.x;
 			}
@@ -1302,22 +1443,48 @@ int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
 		pos.x = get_size().width - pos.x;
 	}
 
-	int closest = -1;
-	int closest_dist = 0x7FFFFFFF;
+	// Rows are sorted vertically, so only the one reaching pos.y can contain it.
+	int lo = 0;
+	int hi = items.size();
+	while (lo < hi) {
+		const int mid = (lo + hi) / 2;
+		const Rect2 &rcache = items[mid].rect_cache;
+		if (rcache.position.y + rcache.size.y < pos.y) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	while (lo > 0 && items[lo - 1].rect_cache.position.y == items[lo].rect_cache.position.y) {
+		lo -= 1;
+	}
 
-	for (int i = 0; i < items.size(); i++) {
+	for (int i = lo; i < items.size() && items[i].rect_cache.position.y <= pos.y; i++) {
 		Rect2 rc = items[i].rect_cache;
 		if (i % current_columns == current_columns - 1) {
 			rc.size.width = get_size().width - rc.position.x; //make sure you can still select the last item when clicking past the column
 		}
 
 		if (rc.has_point(pos)) {
-			closest = i;
-			break;
+			return i;
+		}
+	}
+
+	if (p_exact) {
+		return -1;
+	}
+
+	int closest = -1;
+	int closest_dist = 0x7FFFFFFF;
+
+	for (int i = 0; i < items.size(); i++) {
+		Rect2 rc = items[i].rect_cache;
+		if (i % current_columns == current_columns - 1) {
+			rc.size.width = get_size().width - rc.position.x;
 		}
 
 		float dist = rc.distance_to(pos);
-		if (!p_exact && dist < closest_dist) {
+		if (dist < closest_dist) {
 			closest = i;
 			closest_dist = dist;
 		}
@@ -1451,6 +1618,9 @@ void ItemList::_set_items(const Array &p_items) {
 
 Array ItemList::_get_items() const {
 	Array items;
+	if (!item_source.is_null()) {
+		return items; // Contents belong to the item source.
+	}
 	for (int i = 0; i < get_item_count(); i++) {
 		items.push_back(get_item_text(i));
 		items.push_back(get_item_icon(i));
@@ -1540,7 +1710,10 @@ void ItemList::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("move_item", "from_idx", "to_idx"), &ItemList::move_item);
 
+	ClassDB::bind_method(D_METHOD("set_item_count", "count"), &ItemList::set_item_count);
 	ClassDB::bind_method(D_METHOD("get_item_count"), &ItemList::get_item_count);
+	ClassDB::bind_method(D_METHOD("set_item_source", "source"), &ItemList::set_item_source);
+	ClassDB::bind_method(D_METHOD("get_item_source"), &ItemList::get_item_source);
 	ClassDB::bind_method(D_METHOD("remove_item", "idx"), &ItemList::remove_item);
 
 	ClassDB::bind_method(D_METHOD("clear"), &ItemList::clear);
@@ -74,6 +74,8 @@ private:
 		Rect2 rect_cache;
 		Rect2 min_rect_cache;
 
+		bool pending_fetch = false; // Contents not requested from item_source yet.
+
 		Size2 get_icon_size() const;
 
 		bool operator<(const Item &p_another) const { return text < p_another.text; }
@@ -118,12 +120,20 @@ private:
 
 	bool do_autoscroll_to_bottom = false;
 
+	// When valid, items are only placeholders until they are drawn, at which point their contents are
+	// requested from this callable. They all get the same height, so the layout doesn't measure them.
+	Callable item_source;
+
+	void _fetch_item(int p_idx);
+	float _get_virtual_item_height() const;
+
 	Array _get_items() const;
 	void _set_items(const Array &p_items);
 
 	void _scroll_changed(double);
 	void _gui_input(const Ref<InputEvent> &p_event);
 	void _shape(int p_idx);
+	void _update_scroll_bar(float p_content_height);
 
 protected:
 	void _notification(int p_what);
@@ -194,7 +204,11 @@ public:
 
 	void move_item(int p_from_idx, int p_to_idx);
 
+	void set_item_count(int p_count);
 	int get_item_count() const;
+
+	void set_item_source(const Callable &p_source);
+	Callable get_item_source() const;
 	void remove_item(int p_idx);
 
 	void clear();
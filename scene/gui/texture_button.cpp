@@ -118,6 +118,11 @@ bool TextureButton::has_point(const Point2 &p_point) const {
 	return Control::has_point(p_point);
 }
 
+bool TextureButton::is_hit_test_bounded() const {
+	// The click mask isn't scaled down to the button when there is no texture to draw.
+	return click_mask.is_null() && Control::is_hit_test_bounded();
+}
+
 void TextureButton::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_DRAW: {
@@ -309,6 +314,7 @@ void TextureButton::set_disabled_texture(const Ref<Texture2D> &p_disabled) {
 
 void TextureButton::set_click_mask(const Ref<BitMap> &p_click_mask) {
 	click_mask = p_click_mask;
+	_gui_hit_test_changed();
 	update();
 }
 
@@ -67,6 +67,7 @@ private:
 protected:
 	virtual Size2 get_minimum_size() const override;
 	virtual bool has_point(const Point2 &p_point) const override;
+	virtual bool is_hit_test_bounded() const override;
 	void _notification(int p_what);
 	static void _bind_methods();
 
@@ -526,6 +526,9 @@ void TreeItem::remove_child(TreeItem *p_item) {
 			*c = (*c)->next;
 
 			aux->parent = nullptr;
+			if (tree) {
+				tree->_item_height_changed(this);
+			}
 			return;
 		}
 
@@ -722,6 +725,7 @@ Color TreeItem::get_custom_bg_color(int p_column) const {
 void TreeItem::set_custom_as_button(int p_column, bool p_button) {
 	ERR_FAIL_INDEX(p_column, cells.size());
 	cells.write[p_column].custom_button = p_button;
+	_changed_notify(p_column);
 }
 
 bool TreeItem::is_custom_set_as_button(int p_column) const {
@@ -941,6 +945,9 @@ void TreeItem::clear_children() {
 	}
 
 	children = nullptr;
+	if (tree) {
+		tree->_item_height_changed(this);
+	}
 };
 
 TreeItem::TreeItem(Tree *p_tree) {
@@ -1111,6 +1118,10 @@ int Tree::compute_item_height(TreeItem *p_item) const {
 }
 
 int Tree::get_item_height(TreeItem *p_item) const {
+	if (p_item->subtree_height_version == item_heights_version) {
+		return p_item->subtree_height;
+	}
+
 	int height = compute_item_height(p_item);
 	height += cache.vseparation;
 
@@ -1125,9 +1136,22 @@ int Tree::get_item_height(TreeItem *p_item) const {
 		}
 	}
 
+	p_item->subtree_height = height;
+	p_item->subtree_height_version = item_heights_version;
 	return height;
 }
 
+void Tree::_item_height_changed(TreeItem *p_item) {
+	// The heights of the item's ancestors include it, so they are stale as well.
+	for (TreeItem *it = p_item; it; it = it->parent) {
+		it->subtree_height_version = 0;
+	}
+}
+
+void Tree::_item_heights_changed() {
+	item_heights_version++;
+}
+
 void Tree::draw_item_rect(TreeItem::Cell &p_cell, const Rect2i &p_rect, const Color &p_color, const Color &p_icon_color, int p_ol_size, const Color &p_ol_color) {
 	ERR_FAIL_COND(cache.font.is_null());
 
@@ -1660,6 +1684,11 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
 
 		int prev_ofs = children_pos.y - cache.offset.y + p_draw_ofs.y;
 
+		float line_width = 1.0;
+#ifdef TOOLS_ENABLED
+		line_width *= EDSCALE;
+#endif
+
 		while (c) {
 			if (cache.draw_relationship_lines > 0 && (!hide_root || c->parent != root)) {
 				int root_ofs = children_pos.x + ((p_item->disable_folding || hide_folding) ? cache.hseparation : cache.item_margin);
@@ -1670,11 +1699,6 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
 					root_pos -= Point2i(cache.arrow->get_width(), 0);
 				}
 
-				float line_width = 1.0;
-#ifdef TOOLS_ENABLED
-				line_width *= EDSCALE;
-#endif
-
 				Point2i parent_pos = Point2i(parent_ofs - cache.arrow->get_width() / 2, p_pos.y + label_h / 2 + cache.arrow->get_height() / 2) - cache.offset + p_draw_ofs;
 
 				if (root_pos.y + line_width >= 0) {
@@ -1693,7 +1717,17 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
 			}
 
 			if (htotal >= 0) {
-				int child_h = draw_item(children_pos, p_draw_ofs, p_draw_size, c);
+				// Children entirely above the visible area are skipped using their cached height, so
+				// scrolling down a large tree doesn't walk everything above the view.
+				int child_h = get_item_height(c);
+				int child_bottom = children_pos.y + child_h - cache.offset.y;
+				if (cache.draw_relationship_lines > 0) {
+					// Relationship lines of the subtree may reach a bit past its last label.
+					child_bottom += p_draw_ofs.y + child_h / 2 + cache.arrow->get_height() + line_width;
+				}
+				if (child_bottom >= 0) {
+					child_h = draw_item(children_pos, p_draw_ofs, p_draw_size, c);
+				}
 
 				if (child_h < 0) {
 					if (cache.draw_relationship_lines == 0) {
@@ -3092,6 +3126,7 @@ void Tree::_notification(int p_what) {
 
 	if (p_what == NOTIFICATION_ENTER_TREE) {
 		update_cache();
+		_item_heights_changed();
 	}
 	if (p_what == NOTIFICATION_DRAG_END) {
 		drop_mode_flags = 0;
@@ -3224,6 +3259,7 @@ void Tree::_notification(int p_what) {
 	if (p_what == NOTIFICATION_THEME_CHANGED || p_what == NOTIFICATION_LAYOUT_DIRECTION_CHANGED || p_what == NOTIFICATION_TRANSLATION_CHANGED) {
 		update_cache();
 		_update_all();
+		_item_heights_changed();
 	}
 
 	if (p_what == NOTIFICATION_RESIZED || p_what == NOTIFICATION_TRANSFORM_CHANGED) {
@@ -3284,6 +3320,7 @@ TreeItem *Tree::create_item(TreeItem *p_parent, int p_idx) {
 			p_parent->children = ti;
 		}
 		ti->parent = p_parent;
+		_item_height_changed(p_parent);
 
 	} else {
 		if (!root) {
@@ -3328,6 +3365,9 @@ void Tree::item_edited(int p_column, TreeItem *p_item, bool p_lmb) {
 	if (p_item != nullptr && p_column >= 0 && p_column < p_item->cells.size()) {
 		edited_item->cells.write[p_column].dirty = true;
 	}
+	if (p_item != nullptr) {
+		_item_height_changed(p_item);
+	}
 	if (p_lmb) {
 		emit_signal("item_edited");
 	} else {
@@ -3339,6 +3379,9 @@ void Tree::item_changed(int p_column, TreeItem *p_item) {
 	if (p_item != nullptr && p_column >= 0 && p_column < p_item->cells.size()) {
 		p_item->cells.write[p_column].dirty = true;
 	}
+	if (p_item != nullptr) {
+		_item_height_changed(p_item);
+	}
 	update();
 }
 
@@ -3429,6 +3472,7 @@ void Tree::clear() {
 
 void Tree::set_hide_root(bool p_enabled) {
 	hide_root = p_enabled;
+	_item_heights_changed();
 	update();
 }
 
@@ -3567,6 +3611,7 @@ void Tree::set_columns(int p_columns) {
 	if (root) {
 		propagate_set_columns(root);
 	}
+	_item_heights_changed();
 	if (selected_col >= p_columns) {
 		selected_col = p_columns - 1;
 	}
@@ -3928,7 +3973,14 @@ TreeItem *Tree::_find_item_at_pos(TreeItem *p_item, const Point2 &p_pos, int &r_
 
 	TreeItem *n = p_item->get_children();
 	while (n) {
-		int ch;
+		int ch = get_item_height(n);
+		if (pos.y >= ch) {
+			// The position is below this child and all of its children.
+			pos.y -= ch;
+			h += ch;
+			n = n->get_next();
+			continue;
+		}
 		TreeItem *r = _find_item_at_pos(n, pos, r_column, ch, section);
 		pos.y -= ch;
 		h += ch;
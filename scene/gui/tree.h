@@ -126,6 +126,10 @@ private:
 	bool disable_folding;
 	int custom_min_height;
 
+	// Height of the item and its visible children, valid while the version matches the tree's.
+	mutable int subtree_height = 0;
+	mutable uint64_t subtree_height_version = 0;
+
 	TreeItem *parent; // parent item
 	TreeItem *next; // next in list
 	TreeItem *children; //child items
@@ -380,8 +384,12 @@ private:
 	bool range_up_last = false;
 	void _range_click_timeout();
 
+	uint64_t item_heights_version = 1;
+
 	int compute_item_height(TreeItem *p_item) const;
 	int get_item_height(TreeItem *p_item) const;
+	void _item_height_changed(TreeItem *p_item);
+	void _item_heights_changed();
 	void _update_all();
 	void update_column(int p_col);
 	void update_item_cell(TreeItem *p_item, int p_col);
@@ -33,6 +33,7 @@
 #include "core/input/input.h"
 #include "core/object/message_queue.h"
 #include "scene/2d/canvas_group.h"
+#include "scene/gui/control.h"
 #include "scene/main/canvas_layer.h"
 #include "scene/main/viewport.h"
 #include "scene/main/window.h"
@@ -350,10 +351,29 @@ bool CanvasItem::is_visible_in_tree() const {
 	return true;
 }
 
+void CanvasItem::_gui_hit_test_changed() {
+	// Items outside of the GUI, such as most Node2Ds, can move without rebuilding the picking list.
+	if (!gui_hit_test) {
+		return;
+	}
+
+	Viewport *viewport = get_viewport();
+	if (viewport) {
+		viewport->_gui_hit_test_changed();
+	}
+}
+
+void CanvasItem::_update_gui_hit_test() {
+	// Controls are GUI roots or below one, other items only when a parent that is not top level is.
+	CanvasItem *parent_item = get_parent_item();
+	gui_hit_test = Object::cast_to<Control>(this) || (parent_item && parent_item->gui_hit_test);
+}
+
 void CanvasItem::_propagate_visibility_changed(bool p_visible) {
 	if (p_visible && first_draw) { //avoid propagating it twice
 		first_draw = false;
 	}
+	_gui_hit_test_changed();
 	notification(NOTIFICATION_VISIBILITY_CHANGED);
 
 	if (p_visible) {
@@ -582,6 +602,8 @@ void CanvasItem::_notification(int p_what) {
 				}
 			}
 			_enter_canvas();
+			_update_gui_hit_test();
+			_gui_hit_test_changed();
 			if (!block_transform_notify && !xform_change.in_list()) {
 				get_tree()->xform_change_list.add(&xform_change);
 			}
@@ -590,6 +612,7 @@ void CanvasItem::_notification(int p_what) {
 			if (!is_inside_tree()) {
 				break;
 			}
+			_gui_hit_test_changed();
 
 			if (group != "") {
 				get_tree()->call_group_flags(SceneTree::GROUP_CALL_UNIQUE, group, "_top_level_raise_self");
@@ -605,6 +628,7 @@ void CanvasItem::_notification(int p_what) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
 			_exit_canvas();
+			_gui_hit_test_changed();
 			if (C) {
 				Object::cast_to<CanvasItem>(get_parent())->children_items.erase(C);
 				C = nullptr;
@@ -614,6 +638,10 @@ void CanvasItem::_notification(int p_what) {
 			}
 			global_invalid = true;
 		} break;
+		case NOTIFICATION_SCRIPT_CHANGED: {
+			// Scripts may override _has_point(), see Control::is_hit_test_bounded().
+			_gui_hit_test_changed();
+		} break;
 		case NOTIFICATION_DRAW:
 		case NOTIFICATION_TRANSFORM_CHANGED: {
 		} break;
@@ -677,10 +705,27 @@ void CanvasItem::set_as_top_level(bool p_top_level) {
 		return;
 	}
 
+	_gui_hit_test_changed();
 	_exit_canvas();
 	top_level = p_top_level;
 	_enter_canvas();
 
+	// Items below follow this one in and out of the GUI.
+	_update_gui_hit_test();
+	List<CanvasItem *> items;
+	items.push_back(this);
+	while (items.size()) {
+		CanvasItem *item = items.front()->get();
+		items.pop_front();
+		for (int i = 0; i < item->get_child_count(); i++) {
+			CanvasItem *ci = Object::cast_to<CanvasItem>(item->get_child(i));
+			if (ci && !ci->top_level) {
+				ci->_update_gui_hit_test();
+				items.push_back(ci);
+			}
+		}
+	}
+
 	_notify_transform();
 }
 
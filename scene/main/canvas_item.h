@@ -211,6 +211,7 @@ private:
 	bool use_parent_material = false;
 	bool notify_local_transform = false;
 	bool notify_transform = false;
+	bool gui_hit_test = false; // Inside the subtree of a GUI root, see Viewport::_gui_update_hit_test().
 
 	RS::CanvasItemTextureFilter texture_filter_cache = RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR;
 	RS::CanvasItemTextureRepeat texture_repeat_cache = RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED;
@@ -225,6 +226,7 @@ private:
 	void _top_level_raise_self();
 
 	void _propagate_visibility_changed(bool p_visible);
+	void _update_gui_hit_test();
 
 	void _update_callback();
 
@@ -244,10 +246,13 @@ private:
 	void _update_texture_filter_changed(bool p_propagate);
 
 protected:
+	void _gui_hit_test_changed();
+
 	_FORCE_INLINE_ void _notify_transform() {
 		if (!is_inside_tree()) {
 			return;
 		}
+		_gui_hit_test_changed();
 		_notify_transform(this);
 		if (!block_transform_notify && notify_local_transform) {
 			notification(NOTIFICATION_LOCAL_TRANSFORM_CHANGED);
@@ -48,7 +48,8 @@
 
 VARIANT_ENUM_CAST(Node::ProcessMode);
 
-int Node::orphan_node_count = 0;
+SafeNumeric<int> Node::orphan_node_count;
+SafeNumeric<uint64_t> Node::resolve_version{ 1 };
 
 void Node::_notification(int p_notification) {
 	switch (p_notification) {
@@ -90,7 +91,7 @@ void Node::_notification(int p_notification) {
 			}
 
 			get_tree()->node_count++;
-			orphan_node_count--;
+			orphan_node_count.decrement();
 
 		} break;
 		case NOTIFICATION_EXIT_TREE: {
@@ -98,7 +99,7 @@ void Node::_notification(int p_notification) {
 			ERR_FAIL_COND(!get_tree());
 
 			get_tree()->node_count--;
-			orphan_node_count++;
+			orphan_node_count.increment();
 
 			if (data.input) {
 				remove_from_group("_vp_input" + itos(get_viewport()->get_instance_id()));
@@ -210,6 +211,7 @@ void Node::_propagate_enter_tree() {
 	for (Map<StringName, GroupData>::Element *E = data.grouped.front(); E; E = E->next()) {
 		E->get().group = data.tree->add_to_group(E->key(), this);
 	}
+	_add_to_process_lists();
 
 	notification(NOTIFICATION_ENTER_TREE);
 
@@ -277,6 +279,7 @@ void Node::_propagate_exit_tree() {
 		data.tree->remove_from_group(E->key(), this);
 		E->get().group = nullptr;
 	}
+	_remove_from_process_lists();
 
 	data.viewport = nullptr;
 
@@ -290,6 +293,29 @@ void Node::_propagate_exit_tree() {
 	data.depth = -1;
 }
 
+void Node::_add_to_process_lists() {
+	if (data.process) {
+		data.tree->_add_to_process_list(SceneTree::PROCESS_LIST_PROCESS, this);
+	}
+	if (data.physics_process) {
+		data.tree->_add_to_process_list(SceneTree::PROCESS_LIST_PHYSICS_PROCESS, this);
+	}
+	if (data.process_internal) {
+		data.tree->_add_to_process_list(SceneTree::PROCESS_LIST_INTERNAL_PROCESS, this);
+	}
+	if (data.physics_process_internal) {
+		data.tree->_add_to_process_list(SceneTree::PROCESS_LIST_INTERNAL_PHYSICS_PROCESS, this);
+	}
+}
+
+void Node::_remove_from_process_lists() {
+	for (int i = 0; i < SceneTree::PROCESS_LIST_MAX; i++) {
+		if (data.process_list_index[i] != SceneTree::PROCESS_LIST_INDEX_NONE) {
+			data.tree->_remove_from_process_list(SceneTree::ProcessListType(i), this);
+		}
+	}
+}
+
 void Node::move_child(Node *p_child, int p_pos) {
 	ERR_FAIL_NULL(p_child);
 	ERR_FAIL_INDEX_MSG(p_pos, data.children.size() + 1, "Invalid new child position: " + itos(p_pos) + ".");
@@ -331,6 +357,9 @@ void Node::move_child(Node *p_child, int p_pos) {
 			E->get().group->changed = true;
 		}
 	}
+	if (data.tree) {
+		data.tree->_process_list_order_changed(p_child);
+	}
 
 	data.blocked--;
 }
@@ -362,10 +391,13 @@ void Node::set_physics_process(bool p_process) {
 
 	data.physics_process = p_process;
 
+	if (!data.tree) {
+		return;
+	}
 	if (data.physics_process) {
-		add_to_group("physics_process", false);
+		data.tree->_add_to_process_list(SceneTree::PROCESS_LIST_PHYSICS_PROCESS, this);
 	} else {
-		remove_from_group("physics_process");
+		data.tree->_remove_from_process_list(SceneTree::PROCESS_LIST_PHYSICS_PROCESS, this);
 	}
 }
 
@@ -380,10 +412,13 @@ void Node::set_physics_process_internal(bool p_process_internal) {
 
 	data.physics_process_internal = p_process_internal;
 
+	if (!data.tree) {
+		return;
+	}
 	if (data.physics_process_internal) {
-		add_to_group("physics_process_internal", false);
+		data.tree->_add_to_process_list(SceneTree::PROCESS_LIST_INTERNAL_PHYSICS_PROCESS, this);
 	} else {
-		remove_from_group("physics_process_internal");
+		data.tree->_remove_from_process_list(SceneTree::PROCESS_LIST_INTERNAL_PHYSICS_PROCESS, this);
 	}
 }
 
@@ -894,10 +929,13 @@ void Node::set_process(bool p_process) {
 
 	data.process = p_process;
 
+	if (!data.tree) {
+		return;
+	}
 	if (data.process) {
-		add_to_group("process", false);
+		data.tree->_add_to_process_list(SceneTree::PROCESS_LIST_PROCESS, this);
 	} else {
-		remove_from_group("process");
+		data.tree->_remove_from_process_list(SceneTree::PROCESS_LIST_PROCESS, this);
 	}
 }
 
@@ -912,10 +950,13 @@ void Node::set_process_internal(bool p_process_internal) {
 
 	data.process_internal = p_process_internal;
 
+	if (!data.tree) {
+		return;
+	}
 	if (data.process_internal) {
-		add_to_group("process_internal", false);
+		data.tree->_add_to_process_list(SceneTree::PROCESS_LIST_INTERNAL_PROCESS, this);
 	} else {
-		remove_from_group("process_internal");
+		data.tree->_remove_from_process_list(SceneTree::PROCESS_LIST_INTERNAL_PROCESS, this);
 	}
 }
 
@@ -924,34 +965,34 @@ bool Node::is_processing_internal() const {
 }
 
 void Node::set_process_priority(int p_priority) {
-	data.process_priority = p_priority;
+	if (data.process_priority == p_priority) {
+		return;
+	}
 
 	// Make sure we are in SceneTree.
 	if (data.tree == nullptr) {
+		data.process_priority = p_priority;
 		return;
 	}
 
-	if (is_processing()) {
-		data.tree->make_group_changed("process");
-	}
-
-	if (is_processing_internal()) {
-		data.tree->make_group_changed("process_internal");
-	}
-
-	if (is_physics_processing()) {
-		data.tree->make_group_changed("physics_process");
-	}
-
-	if (is_physics_processing_internal()) {
-		data.tree->make_group_changed("physics_process_internal");
-	}
+	// The process lists are bucketed by priority, move the node to its new buckets.
+	_remove_from_process_lists();
+	data.process_priority = p_priority;
+	_add_to_process_lists();
 }
 
 int Node::get_process_priority() const {
 	return data.process_priority;
 }
 
+void Node::set_process_threaded(bool p_threaded) {
+	data.process_threaded = p_threaded;
+}
+
+bool Node::is_process_threaded() const {
+	return data.process_threaded;
+}
+
 void Node::set_process_input(bool p_enable) {
 	if (p_enable == data.input) {
 		return;
@@ -1018,17 +1059,26 @@ StringName Node::get_name() const {
 }
 
 void Node::_set_name_nocheck(const StringName &p_name) {
+	StringName old_name = data.name;
 	data.name = p_name;
+
+	if (data.parent) {
+		resolve_version.increment();
+		data.parent->_update_child_name(this, old_name);
+	}
 }
 
 void Node::set_name(const String &p_name) {
 	String name = p_name.validate_node_name();
 
 	ERR_FAIL_COND(name == "");
+	StringName old_name = data.name;
 	data.name = name;
 
 	if (data.parent) {
+		resolve_version.increment();
 		data.parent->_validate_child_name(this);
+		data.parent->_update_child_name(this, old_name);
 	}
 
 	propagate_notification(NOTIFICATION_PATH_CHANGED);
@@ -1081,18 +1131,7 @@ void Node::_validate_child_name(Node *p_child, bool p_force_human_readable) {
 			unique = false;
 		} else {
 			//check if exists
-			Node **children = data.children.ptrw();
-			int cc = data.children.size();
-
-			for (int i = 0; i < cc; i++) {
-				if (children[i] == p_child) {
-					continue;
-				}
-				if (children[i]->data.name == p_child->data.name) {
-					unique = false;
-					break;
-				}
-			}
+			unique = !_has_child_named(p_child->data.name, p_child);
 		}
 
 		if (!unique) {
@@ -1149,24 +1188,8 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 	}
 
 	//quickly test if proposed name exists
-	int cc = data.children.size(); //children count
-	const Node *const *children_ptr = data.children.ptr();
-
-	{
-		bool exists = false;
-
-		for (int i = 0; i < cc; i++) {
-			if (children_ptr[i] == p_child) { //exclude self in renaming if it's already a child
-				continue;
-			}
-			if (children_ptr[i]->data.name == name) {
-				exists = true;
-			}
-		}
-
-		if (!exists) {
-			return; //if it does not exist, it does not need validation
-		}
+	if (!_has_child_named(name, p_child)) {
+		return; //if it does not exist, it does not need validation
 	}
 
 	// Extract trailing number
@@ -1191,21 +1214,29 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 		nums = "";
 	}
 
+	// A child being renamed may hold one of the names before a hint, so it searches from the start.
+	const StringName requested = name;
+	if (data.child_name_hints && p_child->data.parent != this) {
+		const ChildNameHint *hint = data.child_name_hints->getptr(requested);
+		if (hint) {
+			name_string = hint->prefix;
+			nums = hint->nums;
+		}
+	}
+
 	for (;;) {
 		StringName attempt = name_string + nums;
-		bool exists = false;
-
-		for (int i = 0; i < cc; i++) {
-			if (children_ptr[i] == p_child) {
-				continue;
-			}
-			if (children_ptr[i]->data.name == attempt) {
-				exists = true;
-			}
-		}
 
-		if (!exists) {
+		if (!_has_child_named(attempt, p_child)) {
 			name = attempt;
+
+			if (!data.child_name_hints) {
+				data.child_name_hints = memnew((HashMap<StringName, ChildNameHint>));
+			}
+			ChildNameHint hint;
+			hint.prefix = name_string;
+			hint.nums = nums;
+			data.child_name_hints->set(requested, hint);
 			return;
 		} else {
 			if (nums.length() == 0) {
@@ -1226,6 +1257,15 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name) {
 	p_child->data.pos = data.children.size();
 	data.children.push_back(p_child);
 	p_child->data.parent = this;
+
+	if (data.child_names) {
+		data.child_names->set(p_name, p_child);
+	} else if (data.children.size() >= CHILD_NAME_INDEX_MIN) {
+		data.child_names = memnew((HashMap<StringName, Node *>));
+		for (int i = 0; i < data.children.size(); i++) {
+			data.child_names->set(data.children[i]->data.name, data.children[i]);
+		}
+	}
 	p_child->notification(NOTIFICATION_PARENTED);
 
 	if (data.tree) {
@@ -1319,6 +1359,19 @@ void Node::remove_child(Node *p_child) {
 	p_child->notification(NOTIFICATION_UNPARENTED);
 
 	data.children.remove(idx);
+	resolve_version.increment();
+
+	// A name before one of the hints may be free again.
+	if (data.child_name_hints) {
+		data.child_name_hints->clear();
+	}
+
+	if (data.child_names) {
+		Node **E = data.child_names->getptr(p_child->data.name);
+		if (E && *E == p_child) {
+			data.child_names->erase(p_child->data.name);
+		}
+	}
 
 	//update pointer and size
 	child_count = data.children.size();
@@ -1354,6 +1407,11 @@ Node *Node::get_child(int p_index) const {
 }
 
 Node *Node::_get_child_by_name(const StringName &p_name) const {
+	if (data.child_names) {
+		Node *const *E = data.child_names->getptr(p_name);
+		return E ? *E : nullptr;
+	}
+
 	int cc = data.children.size();
 	Node *const *cd = data.children.ptr();
 
@@ -1366,13 +1424,41 @@ Node *Node::_get_child_by_name(const StringName &p_name) const {
 	return nullptr;
 }
 
-Node *Node::get_node_or_null(const NodePath &p_path) const {
-	if (p_path.is_empty()) {
-		return nullptr;
+bool Node::_has_child_named(const StringName &p_name, const Node *p_exclude) const {
+	if (data.child_names) {
+		Node *const *E = data.child_names->getptr(p_name);
+		return E && *E != p_exclude;
 	}
 
-	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
+	int cc = data.children.size();
+	Node *const *cd = data.children.ptr();
+
+	for (int i = 0; i < cc; i++) {
+		if (cd[i] != p_exclude && cd[i]->data.name == p_name) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Node::_update_child_name(Node *p_child, const StringName &p_old_name) {
+	if (data.child_name_hints) {
+		data.child_name_hints->clear();
+	}
+
+	if (!data.child_names) {
+		return;
+	}
+
+	Node **E = data.child_names->getptr(p_old_name);
+	if (E && *E == p_child) {
+		data.child_names->erase(p_old_name);
+	}
+	data.child_names->set(p_child->data.name, p_child);
+}
 
+Node *Node::_resolve_path(const NodePath &p_path) const {
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -1406,16 +1492,7 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 			}
 
 		} else {
-			next = nullptr;
-
-			for (int j = 0; j < current->data.children.size(); j++) {
-				Node *child = current->data.children[j];
-
-				if (child->data.name == name) {
-					next = child;
-					break;
-				}
-			}
+			next = current->_get_child_by_name(name);
 			if (next == nullptr) {
 				return nullptr;
 			};
@@ -1426,6 +1503,49 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 	return current;
 }
 
+Node *Node::get_node_or_null(const NodePath &p_path) const {
+	if (p_path.is_empty()) {
+		return nullptr;
+	}
+
+	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
+
+	// Nodes processed on worker threads may resolve paths from the same node, leave the cache alone there.
+	bool use_cache = !MessageQueue::has_thread_singleton();
+
+	if (use_cache && data.resolve_cache) {
+		ResolveCache *cache = data.resolve_cache;
+		if (cache->version == resolve_version.get()) {
+			for (int i = 0; i < ResolveCache::SIZE; i++) {
+				if (cache->nodes[i] && cache->paths[i] == p_path) {
+					return cache->nodes[i];
+				}
+			}
+		} else {
+			for (int i = 0; i < ResolveCache::SIZE; i++) {
+				cache->paths[i] = NodePath();
+				cache->nodes[i] = nullptr;
+			}
+			cache->version = resolve_version.get();
+		}
+	}
+
+	Node *node = _resolve_path(p_path);
+
+	if (node && use_cache) {
+		if (!data.resolve_cache) {
+			data.resolve_cache = memnew(ResolveCache);
+			data.resolve_cache->version = resolve_version.get();
+		}
+		ResolveCache *cache = data.resolve_cache;
+		cache->paths[cache->next] = p_path;
+		cache->nodes[cache->next] = node;
+		cache->next = (cache->next + 1) % ResolveCache::SIZE;
+	}
+
+	return node;
+}
+
 Node *Node::get_node(const NodePath &p_path) const {
 	Node *node = get_node_or_null(p_path);
 
@@ -2720,6 +2840,8 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process", "enable"), &Node::set_process);
 	ClassDB::bind_method(D_METHOD("set_process_priority", "priority"), &Node::set_process_priority);
 	ClassDB::bind_method(D_METHOD("get_process_priority"), &Node::get_process_priority);
+	ClassDB::bind_method(D_METHOD("set_process_threaded", "enable"), &Node::set_process_threaded);
+	ClassDB::bind_method(D_METHOD("is_process_threaded"), &Node::is_process_threaded);
 	ClassDB::bind_method(D_METHOD("is_processing"), &Node::is_processing);
 	ClassDB::bind_method(D_METHOD("set_process_input", "enable"), &Node::set_process_input);
 	ClassDB::bind_method(D_METHOD("is_processing_input"), &Node::is_processing_input);
@@ -2861,6 +2983,7 @@ void Node::_bind_methods() {
 	ADD_GROUP("Process", "process_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_mode", PROPERTY_HINT_ENUM, "Inherit,Pausable,WhenPaused,Always,Disabled"), "set_process_mode", "get_process_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_priority"), "set_process_priority", "get_process_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "process_threaded"), "set_process_threaded", "is_process_threaded");
 
 	ADD_GROUP("Editor Description", "editor_");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "editor_description", PROPERTY_HINT_MULTILINE_TEXT, "", PROPERTY_USAGE_EDITOR | PROPERTY_USAGE_INTERNAL), "set_editor_description", "get_editor_description");
@@ -2891,7 +3014,7 @@ String Node::_get_name_num_separator() {
 }
 
 Node::Node() {
-	orphan_node_count++;
+	orphan_node_count.increment();
 }
 
 Node::~Node() {
@@ -2899,10 +3022,20 @@ Node::~Node() {
 	data.owned.clear();
 	data.children.clear();
 
+	if (data.resolve_cache) {
+		memdelete(data.resolve_cache);
+	}
+	if (data.child_names) {
+		memdelete(data.child_names);
+	}
+	if (data.child_name_hints) {
+		memdelete(data.child_name_hints);
+	}
+
 	ERR_FAIL_COND(data.parent);
 	ERR_FAIL_COND(data.children.size());
 
-	orphan_node_count--;
+	orphan_node_count.decrement();
 }
 
 ////////////////////////////////
@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
 #include "core/string/node_path.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/map.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/scene_tree.h"
@@ -68,11 +69,7 @@ public:
 		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->is_greater_than(p_a); }
 	};
 
-	struct ComparatorWithPriority {
-		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->data.process_priority == p_a->data.process_priority ? p_b->is_greater_than(p_a) : p_b->data.process_priority > p_a->data.process_priority; }
-	};
-
-	static int orphan_node_count;
+	static SafeNumeric<int> orphan_node_count;
 
 private:
 	struct GroupData {
@@ -85,6 +82,33 @@ private:
 		MultiplayerAPI::RPCMode mode = MultiplayerAPI::RPCMode::RPC_MODE_DISABLED;
 	};
 
+	enum {
+		CHILD_NAME_INDEX_MIN = 32, // Children count from which a parent indexes them by name.
+	};
+
+	// Last paths resolved by get_node_or_null(), valid as long as resolve_version doesn't change.
+	struct ResolveCache {
+		enum {
+			SIZE = 4,
+		};
+
+		NodePath paths[SIZE];
+		Node *nodes[SIZE] = {};
+		uint64_t version = 0;
+		uint32_t next = 0;
+	};
+
+	// Where the human readable naming of children stopped searching for a free name, keyed by the
+	// name that was requested. Names before it are taken until a child is removed or renamed.
+	struct ChildNameHint {
+		String prefix;
+		String nums;
+	};
+
+	// Increased when a child node is renamed or removed from its parent. Adding nodes can't change
+	// what a path resolved to before, so it doesn't invalidate the caches.
+	static SafeNumeric<uint64_t> resolve_version;
+
 	struct Data {
 		String filename;
 		Ref<SceneState> instance_state;
@@ -124,6 +148,8 @@ private:
 		bool physics_process = false;
 		bool process = false;
 		int process_priority = 0;
+		bool process_threaded = false;
+		int process_list_index[SceneTree::PROCESS_LIST_MAX] = { SceneTree::PROCESS_LIST_INDEX_NONE, SceneTree::PROCESS_LIST_INDEX_NONE, SceneTree::PROCESS_LIST_INDEX_NONE, SceneTree::PROCESS_LIST_INDEX_NONE };
 
 		bool physics_process_internal = false;
 		bool process_internal = false;
@@ -140,6 +166,9 @@ private:
 		bool editable_instance = false;
 
 		mutable NodePath *path_cache = nullptr;
+		mutable ResolveCache *resolve_cache = nullptr;
+		HashMap<StringName, Node *> *child_names = nullptr;
+		mutable HashMap<StringName, ChildNameHint> *child_name_hints = nullptr;
 
 	} data;
 
@@ -155,6 +184,9 @@ private:
 	void _print_tree(const Node *p_node);
 
 	Node *_get_child_by_name(const StringName &p_name) const;
+	bool _has_child_named(const StringName &p_name, const Node *p_exclude = nullptr) const;
+	void _update_child_name(Node *p_child, const StringName &p_old_name);
+	Node *_resolve_path(const NodePath &p_path) const;
 
 	void _replace_connections_target(Node *p_new_target);
 
@@ -166,6 +198,8 @@ private:
 	void _propagate_enter_tree();
 	void _propagate_ready();
 	void _propagate_exit_tree();
+	void _add_to_process_lists();
+	void _remove_from_process_lists();
 	void _propagate_after_exit_tree();
 	void _propagate_validate_owner();
 	void _print_stray_nodes();
@@ -349,6 +383,9 @@ public:
 	void set_process_priority(int p_priority);
 	int get_process_priority() const;
 
+	void set_process_threaded(bool p_threaded);
+	bool is_process_threaded() const;
+
 	void set_process_input(bool p_enable);
 	bool is_processing_input() const;
 
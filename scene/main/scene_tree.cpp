@@ -42,6 +42,7 @@
 #include "core/string/print_string.h"
 #include "node.h"
 #include "scene/debugger/scene_debugger.h"
+#include "scene/gui/container.h"
 #include "scene/resources/font.h"
 #include "scene/resources/material.h"
 #include "scene/resources/mesh.h"
@@ -51,6 +52,7 @@
 #include "servers/navigation_server_3d.h"
 #include "servers/physics_server_2d.h"
 #include "servers/physics_server_3d.h"
+#include "servers/rendering_server.h"
 #include "window.h"
 
 #include <stdio.h>
@@ -67,14 +69,26 @@ void SceneTreeTimer::_bind_methods() {
 
 void SceneTreeTimer::set_time_left(float p_time) {
 	time_left = p_time;
+	if (handle.is_scheduled()) {
+		tree->timers.schedule(&handle, handle.queue, p_time);
+	}
 }
 
 float SceneTreeTimer::get_time_left() const {
+	if (handle.is_scheduled()) {
+		return tree->timers.get_time_left(&handle);
+	}
 	return time_left;
 }
 
 void SceneTreeTimer::set_process_always(bool p_process_always) {
+	if (process_always == p_process_always) {
+		return;
+	}
 	process_always = p_process_always;
+	if (handle.is_scheduled()) {
+		tree->timers.move(&handle, process_always ? SceneTree::TIMER_QUEUE_SCENE_TREE : SceneTree::TIMER_QUEUE_SCENE_TREE_PAUSABLE);
+	}
 }
 
 bool SceneTreeTimer::is_process_always() {
@@ -91,7 +105,18 @@ void SceneTreeTimer::release_connections() {
 	}
 }
 
-SceneTreeTimer::SceneTreeTimer() {}
+void SceneTreeTimer::_timeout(Object *p_owner) {
+	// The queue held a reference while the timer was scheduled, keep it alive until the signal is emitted.
+	Ref<SceneTreeTimer> timer = Ref<SceneTreeTimer>(static_cast<SceneTreeTimer *>(p_owner));
+	timer->unreference();
+	timer->time_left = timer->tree->timers.get_time_left(&timer->handle);
+	timer->emit_signal("timeout");
+}
+
+SceneTreeTimer::SceneTreeTimer() {
+	handle.owner = this;
+	handle.timeout = &SceneTreeTimer::_timeout;
+}
 
 void SceneTree::tree_changed() {
 	tree_version++;
@@ -147,6 +172,8 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 }
 
 void SceneTree::flush_transform_notifications() {
+	xform_flush_lock++;
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -155,6 +182,84 @@ void SceneTree::flush_transform_notifications() {
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
+
+	xform_flush_lock--;
+	if (xform_flush_lock == 0) {
+		_flush_server_transforms();
+	}
+}
+
+void SceneTree::set_instance_transform(RID p_instance, const Transform &p_transform) {
+	if (xform_flush_lock == 0) {
+		RenderingServer::get_singleton()->instance_set_transform(p_instance, p_transform);
+		return;
+	}
+	xform_instances.rids.push_back(p_instance);
+	xform_instances.transforms.push_back(p_transform);
+}
+
+void SceneTree::set_body_transform(RID p_body, const Transform &p_transform) {
+	if (xform_flush_lock == 0) {
+		PhysicsServer3D::get_singleton()->body_set_state(p_body, PhysicsServer3D::BODY_STATE_TRANSFORM, p_transform);
+		return;
+	}
+	xform_bodies.rids.push_back(p_body);
+	xform_bodies.transforms.push_back(p_transform);
+}
+
+void SceneTree::cancel_instance_transform(RID p_instance) {
+	_cancel_server_transform(xform_instances, p_instance);
+}
+
+void SceneTree::cancel_body_transform(RID p_body) {
+	_cancel_server_transform(xform_bodies, p_body);
+}
+
+void SceneTree::_cancel_server_transform(ServerTransforms &p_queue, RID p_rid) {
+	// Keeps the order, a node moved twice during the flush must end up with its last transform.
+	uint32_t kept = 0;
+	for (uint32_t i = 0; i < p_queue.rids.size(); i++) {
+		if (p_queue.rids[i] == p_rid) {
+			continue;
+		}
+		p_queue.rids[kept] = p_queue.rids[i];
+		p_queue.transforms[kept] = p_queue.transforms[i];
+		kept++;
+	}
+	p_queue.rids.resize(kept);
+	p_queue.transforms.resize(kept);
+}
+
+static void _server_transforms_to_vectors(const LocalVector<RID> &p_rids, const LocalVector<Transform> &p_transforms, Vector<RID> &r_rids, Vector<Transform> &r_transforms) {
+	r_rids.resize(p_rids.size());
+	r_transforms.resize(p_transforms.size());
+	RID *rids = r_rids.ptrw();
+	Transform *transforms = r_transforms.ptrw();
+	for (uint32_t i = 0; i < p_rids.size(); i++) {
+		rids[i] = p_rids[i];
+		transforms[i] = p_transforms[i];
+	}
+}
+
+void SceneTree::_flush_server_transforms() {
+	// Each call is a single command when the servers run on their own thread, instead of one per node.
+	if (xform_instances.rids.size()) {
+		Vector<RID> rids;
+		Vector<Transform> transforms;
+		_server_transforms_to_vectors(xform_instances.rids, xform_instances.transforms, rids, transforms);
+		xform_instances.rids.clear();
+		xform_instances.transforms.clear();
+		RenderingServer::get_singleton()->instances_set_transform(rids, transforms);
+	}
+
+	if (xform_bodies.rids.size()) {
+		Vector<RID> rids;
+		Vector<Transform> transforms;
+		_server_transforms_to_vectors(xform_bodies.rids, xform_bodies.transforms, rids, transforms);
+		xform_bodies.rids.clear();
+		xform_bodies.transforms.clear();
+		PhysicsServer3D::get_singleton()->bodies_set_transform(rids, transforms);
+	}
 }
 
 void SceneTree::_flush_ugc() {
@@ -177,7 +282,7 @@ void SceneTree::_flush_ugc() {
 	ugc_locked = false;
 }
 
-void SceneTree::_update_group_order(Group &g, bool p_use_priority) {
+void SceneTree::_update_group_order(Group &g) {
 	if (!g.changed) {
 		return;
 	}
@@ -188,13 +293,8 @@ void SceneTree::_update_group_order(Group &g, bool p_use_priority) {
 	Node **nodes = g.nodes.ptrw();
 	int node_count = g.nodes.size();
 
-	if (p_use_priority) {
-		SortArray<Node *, Node::ComparatorWithPriority> node_sort;
-		node_sort.sort(nodes, node_count);
-	} else {
-		SortArray<Node *, Node::Comparator> node_sort;
-		node_sort.sort(nodes, node_count);
-	}
+	SortArray<Node *, Node::Comparator> node_sort;
+	node_sort.sort(nodes, node_count);
 	g.changed = false;
 }
 
@@ -407,9 +507,10 @@ bool SceneTree::physics_process(float p_time) {
 
 	emit_signal("physics_frame");
 
-	_notify_group_pause("physics_process_internal", Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
+	_notify_process_list(PROCESS_LIST_INTERNAL_PHYSICS_PROCESS, Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
+	timers.process(TIMER_QUEUE_PHYSICS_PROCESS, p_time);
 	call_group_flags(GROUP_CALL_REALTIME, "_viewports", "_process_picking");
-	_notify_group_pause("physics_process", Node::NOTIFICATION_PHYSICS_PROCESS);
+	_notify_process_list(PROCESS_LIST_PHYSICS_PROCESS, Node::NOTIFICATION_PHYSICS_PROCESS);
 	_flush_ugc();
 	MessageQueue::get_singleton()->flush(); //small little hack
 	flush_transform_notifications();
@@ -429,6 +530,16 @@ bool SceneTree::process(float p_time) {
 
 	process_time = p_time;
 
+	last_frame_layout_sorts = layout_sorts;
+	last_frame_layout_usec = layout_usec;
+	layout_sorts = 0;
+	layout_usec = 0;
+
+	if (layout_flush_deferred) {
+		layout_flush_deferred = false;
+		MessageQueue::get_singleton()->push_callable(callable_mp(this, &SceneTree::_flush_layout));
+	}
+
 	if (multiplayer_poll) {
 		multiplayer->poll();
 	}
@@ -439,8 +550,9 @@ bool SceneTree::process(float p_time) {
 
 	flush_transform_notifications();
 
-	_notify_group_pause("process_internal", Node::NOTIFICATION_INTERNAL_PROCESS);
-	_notify_group_pause("process", Node::NOTIFICATION_PROCESS);
+	_notify_process_list(PROCESS_LIST_INTERNAL_PROCESS, Node::NOTIFICATION_INTERNAL_PROCESS);
+	timers.process(TIMER_QUEUE_PROCESS, p_time);
+	_notify_process_list(PROCESS_LIST_PROCESS, Node::NOTIFICATION_PROCESS);
 
 	_flush_ugc();
 	MessageQueue::get_singleton()->flush(); //small little hack
@@ -453,29 +565,9 @@ bool SceneTree::process(float p_time) {
 
 	//go through timers
 
-	List<Ref<SceneTreeTimer>>::Element *L = timers.back(); //last element
-
-	for (List<Ref<SceneTreeTimer>>::Element *E = timers.front(); E;) {
-		List<Ref<SceneTreeTimer>>::Element *N = E->next();
-		if (paused && !E->get()->is_process_always()) {
-			if (E == L) {
-				break; //break on last, so if new timers were added during list traversal, ignore them.
-			}
-			E = N;
-			continue;
-		}
-		float time_left = E->get()->get_time_left();
-		time_left -= p_time;
-		E->get()->set_time_left(time_left);
-
-		if (time_left < 0) {
-			E->get()->emit_signal("timeout");
-			timers.erase(E);
-		}
-		if (E == L) {
-			break; //break on last, so if new timers were added during list traversal, ignore them.
-		}
-		E = N;
+	timers.process(TIMER_QUEUE_SCENE_TREE, p_time);
+	if (!paused) {
+		timers.process(TIMER_QUEUE_SCENE_TREE_PAUSABLE, p_time);
 	}
 
 	flush_transform_notifications(); //additional transforms after timers update
@@ -529,10 +621,7 @@ void SceneTree::finalize() {
 	}
 
 	// cleanup timers
-	for (List<Ref<SceneTreeTimer>>::Element *E = timers.front(); E; E = E->next()) {
-		E->get()->release_connections();
-	}
-	timers.clear();
+	_clear_timers();
 }
 
 void SceneTree::quit(int p_exit_code) {
@@ -772,48 +861,108 @@ bool SceneTree::is_paused() const {
 	return paused;
 }
 
-void SceneTree::_notify_group_pause(const StringName &p_group, int p_notification) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
-		return;
+void SceneTree::_process_threaded_chunk(uint32_t p_chunk, ThreadedProcess *p_process) {
+	uint32_t from = p_process->nodes.size() * p_chunk / p_process->chunk_count;
+	uint32_t to = p_process->nodes.size() * (p_chunk + 1) / p_process->chunk_count;
+
+	MessageQueue::set_thread_singleton(process_thread_queues[p_chunk]);
+	for (uint32_t i = from; i < to; i++) {
+		p_process->nodes[i]->notification(p_process->notification);
 	}
-	Group &g = E->get();
-	if (g.nodes.is_empty()) {
+	MessageQueue::set_thread_singleton(nullptr);
+}
+
+void SceneTree::_notify_threaded(int p_notification) {
+	if (process_thread_pool.get_thread_count() == 0) {
+		process_thread_pool.init();
+	}
+
+	threaded_process.notification = p_notification;
+	threaded_process.chunk_count = MIN((uint32_t)process_thread_pool.get_thread_count(), threaded_process.nodes.size());
+
+	while (process_thread_queues.size() < threaded_process.chunk_count) {
+		uint32_t queue_size = int(GLOBAL_GET("memory/limits/message_queue/max_size_kb")) * 1024;
+		process_thread_queues.push_back(memnew(MessageQueue(queue_size)));
+	}
+
+	process_thread_pool.do_work(threaded_process.chunk_count, this, &SceneTree::_process_threaded_chunk, &threaded_process);
+
+	for (uint32_t i = 0; i < threaded_process.chunk_count; i++) {
+		process_thread_queues[i]->transfer_to(MessageQueue::get_singleton());
+	}
+	threaded_process.nodes.clear();
+}
+
+int SceneTree::ProcessListAccessor::get_priority(const Node *p_node) const {
+	return p_node->data.process_priority;
+}
+
+int &SceneTree::ProcessListAccessor::get_index(Node *p_node) const {
+	return p_node->data.process_list_index[type];
+}
+
+bool SceneTree::ProcessListAccessor::less(const Node *p_a, const Node *p_b) const {
+	return p_b->is_greater_than(p_a);
+}
+
+void SceneTree::_add_to_process_list(ProcessListType p_type, Node *p_node) {
+	process_lists[p_type].add(p_node);
+}
+
+void SceneTree::_remove_from_process_list(ProcessListType p_type, Node *p_node) {
+	process_lists[p_type].remove(p_node);
+}
+
+void SceneTree::_process_list_order_changed(Node *p_node) {
+	for (int i = 0; i < PROCESS_LIST_MAX; i++) {
+		process_lists[i].order_changed(p_node);
+	}
+}
+
+void SceneTree::_notify_process_list(ProcessListType p_type, int p_notification) {
+	ProcessList &list = process_lists[p_type];
+	if (list.is_iterating()) {
 		return;
 	}
 
-	_update_group_order(g, p_notification == Node::NOTIFICATION_PROCESS || p_notification == Node::NOTIFICATION_INTERNAL_PROCESS || p_notification == Node::NOTIFICATION_PHYSICS_PROCESS || p_notification == Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
+	// Only user callbacks are threaded, engine nodes rely on internal processing running on the main thread.
+	bool allow_threaded = p_type == PROCESS_LIST_PROCESS || p_type == PROCESS_LIST_PHYSICS_PROCESS;
 
-	//copy, so copy on write happens in case something is removed from process while being called
-	//performance is not lost because only if something is added/removed the vector is copied.
-	Vector<Node *> nodes_copy = g.nodes;
+	list.begin_iteration();
 
-	int node_count = nodes_copy.size();
-	Node **nodes = nodes_copy.ptrw();
+	for (uint32_t i = 0; i < list.get_bucket_count(); i++) {
+		for (uint32_t j = 0; j < list.get_bucket_size(i); j++) {
+			Node *n = list.get_item(i, j);
+			if (!n) {
+				continue; // Removed while iterating.
+			}
 
-	call_lock++;
+			if (!n->can_process()) {
+				continue;
+			}
+			if (!n->can_process_notification(p_notification)) {
+				continue;
+			}
 
-	for (int i = 0; i < node_count; i++) {
-		Node *n = nodes[i];
-		if (call_lock && call_skip.has(n)) {
-			continue;
-		}
+			if (allow_threaded && n->is_process_threaded()) {
+				// Gather the whole run of threaded nodes, so the processing order is kept with the others.
+				threaded_process.nodes.push_back(n);
+				continue;
+			}
+			if (threaded_process.nodes.size()) {
+				_notify_threaded(p_notification);
+			}
 
-		if (!n->can_process()) {
-			continue;
-		}
-		if (!n->can_process_notification(p_notification)) {
-			continue;
+			n->notification(p_notification);
 		}
 
-		n->notification(p_notification);
-		//ERR_FAIL_COND(node_count != g.nodes.size());
+		// Buckets are by priority, threaded nodes only run together with those of the same priority.
+		if (threaded_process.nodes.size()) {
+			_notify_threaded(p_notification);
+		}
 	}
 
-	call_lock--;
-	if (call_lock == 0) {
-		call_skip.clear();
-	}
+	list.end_iteration();
 }
 
 /*
@@ -1004,6 +1153,90 @@ void SceneTree::queue_delete(Object *p_object) {
 	delete_queue.push_back(p_object->get_instance_id());
 }
 
+void SceneTree::_queue_layout(ObjectID p_control, bool p_sort) {
+	if (MessageQueue::has_thread_singleton()) {
+		// Queued from threaded processing, let the main thread add it once the chunk queues are flushed.
+		MessageQueue::get_singleton()->push_callable(callable_mp(this, &SceneTree::_queue_layout), p_control, p_sort);
+		return;
+	}
+
+	if (p_sort) {
+		layout_sort_queue.push_back(p_control);
+	} else {
+		layout_minimum_size_queue.push_back(p_control);
+	}
+
+	if (!layout_flush_queued) {
+		MessageQueue::get_singleton()->push_callable(callable_mp(this, &SceneTree::_flush_layout));
+		layout_flush_queued = true;
+	}
+}
+
+struct _LayoutItem {
+	int depth = 0;
+	uint32_t order = 0;
+	ObjectID control;
+
+	bool operator<(const _LayoutItem &p_item) const {
+		return depth == p_item.depth ? order < p_item.order : depth < p_item.depth;
+	}
+};
+
+void SceneTree::_flush_layout() {
+	uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+
+	LocalVector<_LayoutItem> items;
+
+	// Sorting can change minimum sizes again (wrapped text depends on its width), so repeat until it settles.
+	// Controls queued meanwhile are taken by a later batch, layout_flush_queued stays set so no other flush is queued.
+	for (int batch = 0; batch < LAYOUT_MAX_BATCHES && (layout_minimum_size_queue.size() || layout_sort_queue.size()); batch++) {
+		// Minimum sizes are settled before any container is sorted.
+		bool minimum_sizes = layout_minimum_size_queue.size() > 0;
+		LocalVector<ObjectID> &queue = minimum_sizes ? layout_minimum_size_queue : layout_sort_queue;
+
+		items.clear();
+		for (uint32_t i = 0; i < queue.size(); i++) {
+			Control *control = Object::cast_to<Control>(ObjectDB::get_instance(queue[i]));
+			if (control) {
+				_LayoutItem item;
+				item.depth = static_cast<Node *>(control)->data.depth;
+				if (minimum_sizes) {
+					item.depth = -item.depth; // Deepest first.
+				}
+				item.order = i;
+				item.control = queue[i];
+				items.push_back(item);
+			}
+		}
+		queue.clear();
+		items.sort();
+
+		// Containers resized by their parent here are already in this batch, or are queued for the next one.
+		for (uint32_t i = 0; i < items.size(); i++) {
+			// Handlers of an earlier item may have freed this one.
+			Control *control = Object::cast_to<Control>(ObjectDB::get_instance(items[i].control));
+			if (!control) {
+				continue;
+			}
+			if (minimum_sizes) {
+				control->_update_minimum_size();
+			} else {
+				static_cast<Container *>(control)->_sort_children();
+				layout_sorts++;
+			}
+		}
+	}
+
+	if (layout_minimum_size_queue.size() || layout_sort_queue.size()) {
+		// Still changing after many batches, leave the rest for the next frame.
+		layout_flush_deferred = true;
+	} else {
+		layout_flush_queued = false;
+	}
+
+	layout_usec += OS::get_singleton()->get_ticks_usec() - begin_usec;
+}
+
 int SceneTree::get_node_count() const {
 	return node_count;
 }
@@ -1087,10 +1320,181 @@ Ref<SceneTreeTimer> SceneTree::create_timer(float p_delay_sec, bool p_process_al
 	stt.instance();
 	stt->set_process_always(p_process_always);
 	stt->set_time_left(p_delay_sec);
-	timers.push_back(stt);
+	stt->tree = this;
+	stt->reference(); // Released when it times out, see SceneTreeTimer::_timeout().
+	timers.schedule(&stt->handle, p_process_always ? TIMER_QUEUE_SCENE_TREE : TIMER_QUEUE_SCENE_TREE_PAUSABLE, p_delay_sec);
 	return stt;
 }
 
+void SceneTreeTimerScheduler::_sift_up(Queue &p_queue, uint32_t p_index) {
+	SceneTreeTimerHandle **heap = p_queue.heap.ptr();
+	SceneTreeTimerHandle *handle = heap[p_index];
+	while (p_index > 0) {
+		uint32_t parent = (p_index - 1) / 2;
+		if (!_less(handle, heap[parent])) {
+			break;
+		}
+		heap[p_index] = heap[parent];
+		heap[p_index]->index = p_index;
+		p_index = parent;
+	}
+	heap[p_index] = handle;
+	handle->index = p_index;
+}
+
+void SceneTreeTimerScheduler::_sift_down(Queue &p_queue, uint32_t p_index) {
+	SceneTreeTimerHandle **heap = p_queue.heap.ptr();
+	const uint32_t size = p_queue.heap.size();
+	SceneTreeTimerHandle *handle = heap[p_index];
+	while (true) {
+		uint32_t child = p_index * 2 + 1;
+		if (child >= size) {
+			break;
+		}
+		if (child + 1 < size && _less(heap[child + 1], heap[child])) {
+			child++;
+		}
+		if (!_less(heap[child], handle)) {
+			break;
+		}
+		heap[p_index] = heap[child];
+		heap[p_index]->index = p_index;
+		p_index = child;
+	}
+	heap[p_index] = handle;
+	handle->index = p_index;
+}
+
+void SceneTreeTimerScheduler::_remove(Queue &p_queue, uint32_t p_index) {
+	SceneTreeTimerHandle *removed = p_queue.heap[p_index];
+	SceneTreeTimerHandle *last = p_queue.heap[p_queue.heap.size() - 1];
+	p_queue.heap.resize(p_queue.heap.size() - 1);
+	removed->index = SceneTreeTimerHandle::INDEX_NONE;
+
+	if (last == removed) {
+		return;
+	}
+	p_queue.heap[p_index] = last;
+	if (p_index > 0 && _less(last, p_queue.heap[(p_index - 1) / 2])) {
+		_sift_up(p_queue, p_index);
+	} else {
+		_sift_down(p_queue, p_index);
+	}
+}
+
+void SceneTreeTimerScheduler::schedule(SceneTreeTimerHandle *p_handle, uint32_t p_queue, double p_time_left) {
+	ERR_FAIL_UNSIGNED_INDEX(p_queue, queues.size());
+	unschedule(p_handle);
+
+	Queue &queue = queues[p_queue];
+	p_handle->expiry = queue.clock + p_time_left;
+	p_handle->sequence = sequence++;
+	p_handle->queue = p_queue;
+	queue.heap.push_back(p_handle);
+	_sift_up(queue, queue.heap.size() - 1);
+}
+
+double SceneTreeTimerScheduler::unschedule(SceneTreeTimerHandle *p_handle) {
+	if (!p_handle->is_scheduled()) {
+		return 0.0;
+	}
+	double time_left = get_time_left(p_handle);
+	if (p_handle->index == SceneTreeTimerHandle::INDEX_HELD) {
+		held.erase(p_handle);
+		p_handle->index = SceneTreeTimerHandle::INDEX_NONE;
+	} else {
+		_remove(queues[p_handle->queue], p_handle->index);
+	}
+	return time_left;
+}
+
+void SceneTreeTimerScheduler::move(SceneTreeTimerHandle *p_handle, uint32_t p_queue) {
+	ERR_FAIL_UNSIGNED_INDEX(p_queue, queues.size());
+	if (!p_handle->is_scheduled()) {
+		p_handle->queue = p_queue;
+		return;
+	}
+	schedule(p_handle, p_queue, unschedule(p_handle));
+}
+
+double SceneTreeTimerScheduler::get_time_left(const SceneTreeTimerHandle *p_handle) const {
+	return p_handle->expiry - queues[p_handle->queue].clock;
+}
+
+void SceneTreeTimerScheduler::process(uint32_t p_queue, double p_time) {
+	ERR_FAIL_UNSIGNED_INDEX(p_queue, queues.size());
+	Queue &queue = queues[p_queue];
+	queue.clock += p_time;
+
+	// Timers scheduled or repeated from a timeout callback wait for the next frame, even if they
+	// are already late, so a timer never fires twice in a frame.
+	const uint64_t sequence_limit = sequence;
+
+	while (queue.heap.size() && queue.heap[0]->expiry < queue.clock) {
+		SceneTreeTimerHandle *handle = queue.heap[0];
+		_remove(queue, 0);
+
+		if (handle->sequence >= sequence_limit) {
+			handle->index = SceneTreeTimerHandle::INDEX_HELD;
+			held.push_back(handle);
+			continue;
+		}
+
+		if (handle->repeat > 0.0) {
+			// Rescheduled before the callback, which may still stop or restart it.
+			handle->expiry += handle->repeat;
+			handle->sequence = sequence++;
+			handle->index = SceneTreeTimerHandle::INDEX_HELD;
+			held.push_back(handle);
+		}
+
+		handle->timeout(handle->owner);
+	}
+
+	for (uint32_t i = 0; i < held.size(); i++) {
+		SceneTreeTimerHandle *handle = held[i];
+		Queue &target = queues[handle->queue];
+		target.heap.push_back(handle);
+		_sift_up(target, target.heap.size() - 1);
+	}
+	held.clear();
+}
+
+void SceneTreeTimerScheduler::clear(LocalVector<SceneTreeTimerHandle *> &r_removed) {
+	for (uint32_t i = 0; i < queues.size(); i++) {
+		Queue &queue = queues[i];
+		while (queue.heap.size()) {
+			SceneTreeTimerHandle *handle = queue.heap[queue.heap.size() - 1];
+			_remove(queue, queue.heap.size() - 1);
+			r_removed.push_back(handle);
+		}
+	}
+	for (uint32_t i = 0; i < held.size(); i++) {
+		held[i]->index = SceneTreeTimerHandle::INDEX_NONE;
+		r_removed.push_back(held[i]);
+	}
+	held.clear();
+}
+
+SceneTreeTimerScheduler::SceneTreeTimerScheduler(uint32_t p_queue_count) {
+	queues.resize(p_queue_count);
+}
+
+void SceneTree::_clear_timers() {
+	LocalVector<SceneTreeTimerHandle *> removed;
+	timers.clear(removed);
+
+	for (uint32_t i = 0; i < removed.size(); i++) {
+		SceneTreeTimer *timer = Object::cast_to<SceneTreeTimer>(removed[i]->owner);
+		if (timer) {
+			timer->release_connections();
+			if (timer->unreference()) {
+				memdelete(timer);
+			}
+		}
+	}
+}
+
 void SceneTree::_network_peer_connected(int p_id) {
 	emit_signal("network_peer_connected", p_id);
 }
@@ -1349,6 +1753,12 @@ SceneTree::SceneTree() {
 
 	GLOBAL_DEF("debug/shapes/collision/draw_2d_outlines", true);
 
+	for (int i = 0; i < PROCESS_LIST_MAX; i++) {
+		ProcessListAccessor accessor;
+		accessor.type = ProcessListType(i);
+		process_lists[i].set_accessor(accessor);
+	}
+
 	// Create with mainloop.
 
 	root = memnew(Window);
@@ -1458,12 +1868,19 @@ SceneTree::SceneTree() {
 }
 
 SceneTree::~SceneTree() {
+	process_thread_pool.finish();
+	for (uint32_t i = 0; i < process_thread_queues.size(); i++) {
+		memdelete(process_thread_queues[i]);
+	}
+
 	if (root) {
 		root->_set_tree(nullptr);
 		root->_propagate_after_exit_tree();
 		memdelete(root);
 	}
 
+	_clear_timers();
+
 	if (singleton == this) {
 		singleton = nullptr;
 	}
@@ -34,26 +34,265 @@
 #include "core/io/multiplayer_api.h"
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/self_list.h"
+#include "core/templates/sort_array.h"
+#include "core/templates/thread_work_pool.h"
 #include "scene/resources/mesh.h"
 #include "scene/resources/world_2d.h"
 #include "scene/resources/world_3d.h"
 
 #undef Window
 
+class MessageQueue;
 class PackedScene;
+class SceneTree;
 class Node;
 class Window;
 class Material;
 class Mesh;
 class SceneDebugger;
 
+// Deadline in one of the queues of a SceneTreeTimerScheduler. Its owner embeds it and is called back
+// through `timeout` once the clock of the queue goes past `expiry`.
+struct SceneTreeTimerHandle {
+	enum {
+		INDEX_NONE = -1,
+		INDEX_HELD = -2,
+	};
+
+	double expiry = 0.0;
+	double repeat = 0.0; // If positive, scheduled again this much later every time it times out.
+	uint64_t sequence = 0;
+	int32_t index = INDEX_NONE;
+	uint32_t queue = 0;
+	Object *owner = nullptr;
+	void (*timeout)(Object *p_owner) = nullptr;
+
+	_FORCE_INLINE_ bool is_scheduled() const { return index != INDEX_NONE; }
+};
+
+// Timers are kept in binary min-heaps ordered by expiry, one per clock, so a frame only touches
+// the timers that expire in it.
+class SceneTreeTimerScheduler {
+	struct Queue {
+		LocalVector<SceneTreeTimerHandle *> heap;
+		double clock = 0.0;
+	};
+
+	LocalVector<Queue> queues;
+	LocalVector<SceneTreeTimerHandle *> held; // Expired again while processing, wait for the next frame.
+	uint64_t sequence = 0;
+
+	_FORCE_INLINE_ static bool _less(const SceneTreeTimerHandle *p_a, const SceneTreeTimerHandle *p_b) {
+		return p_a->expiry == p_b->expiry ? p_a->sequence < p_b->sequence : p_a->expiry < p_b->expiry;
+	}
+	void _sift_up(Queue &p_queue, uint32_t p_index);
+	void _sift_down(Queue &p_queue, uint32_t p_index);
+	void _remove(Queue &p_queue, uint32_t p_index);
+
+public:
+	void schedule(SceneTreeTimerHandle *p_handle, uint32_t p_queue, double p_time_left);
+	double unschedule(SceneTreeTimerHandle *p_handle); // Returns the time that was left.
+	void move(SceneTreeTimerHandle *p_handle, uint32_t p_queue); // Keeps the time left.
+	double get_time_left(const SceneTreeTimerHandle *p_handle) const;
+
+	// Advances the clock of the queue and calls back the timers that expire, each at most once.
+	void process(uint32_t p_queue, double p_time);
+	void clear(LocalVector<SceneTreeTimerHandle *> &r_removed);
+
+	SceneTreeTimerScheduler(uint32_t p_queue_count);
+};
+
+// Items receiving a process notification, in buckets of increasing priority, each sorted with the accessor's
+// less(). Each item stores its index in the bucket through the accessor, so it can be removed without a search:
+// its slot is set to nullptr, and the bucket is compacted before the next iteration. While the list is iterated,
+// items added to it wait in `pending`, so the buckets never change size and don't need to be copied.
+template <class T, class A>
+class SceneTreeProcessList {
+public:
+	enum {
+		INDEX_NONE = -1,
+		INDEX_PENDING = -2,
+	};
+
+private:
+	struct Bucket {
+		int priority = 0;
+		LocalVector<T *> items;
+		bool sorted = true;
+		bool has_removed = false;
+	};
+
+	struct Comparator {
+		A accessor;
+		_FORCE_INLINE_ bool operator()(const T *p_a, const T *p_b) const { return accessor.less(p_a, p_b); }
+	};
+
+	A accessor;
+	LocalVector<Bucket *> buckets;
+	LocalVector<T *> pending;
+	int iterating = 0;
+
+	Bucket *_get_bucket(int p_priority, bool p_create) {
+		// Few distinct priorities are used, a linear search is enough.
+		uint32_t pos = 0;
+		for (; pos < buckets.size(); pos++) {
+			if (buckets[pos]->priority == p_priority) {
+				return buckets[pos];
+			}
+			if (buckets[pos]->priority > p_priority) {
+				break;
+			}
+		}
+
+		if (!p_create) {
+			return nullptr;
+		}
+
+		Bucket *bucket = memnew(Bucket);
+		bucket->priority = p_priority;
+		buckets.insert(pos, bucket);
+		return bucket;
+	}
+
+	void _insert(T *p_item) {
+		Bucket *bucket = _get_bucket(accessor.get_priority(p_item), true);
+
+		if (bucket->sorted) {
+			// Items are mostly added in order, only sort when they are not.
+			for (int i = int(bucket->items.size()) - 1; i >= 0; i--) {
+				if (bucket->items[i]) {
+					bucket->sorted = accessor.less(bucket->items[i], p_item);
+					break;
+				}
+			}
+		}
+
+		accessor.get_index(p_item) = bucket->items.size();
+		bucket->items.push_back(p_item);
+	}
+
+	void _update() {
+		for (uint32_t i = 0; i < buckets.size();) {
+			Bucket *bucket = buckets[i];
+
+			if (bucket->has_removed) {
+				uint32_t count = 0;
+				for (uint32_t j = 0; j < bucket->items.size(); j++) {
+					T *item = bucket->items[j];
+					if (item) {
+						accessor.get_index(item) = count;
+						bucket->items[count++] = item;
+					}
+				}
+				bucket->items.resize(count);
+				bucket->has_removed = false;
+			}
+
+			if (bucket->items.is_empty()) {
+				memdelete(bucket);
+				buckets.remove(i);
+				continue;
+			}
+
+			if (!bucket->sorted) {
+				SortArray<T *, Comparator> sorter;
+				sorter.compare.accessor = accessor;
+				sorter.sort(bucket->items.ptr(), bucket->items.size());
+				for (uint32_t j = 0; j < bucket->items.size(); j++) {
+					accessor.get_index(bucket->items[j]) = j;
+				}
+				bucket->sorted = true;
+			}
+
+			i++;
+		}
+	}
+
+public:
+	void add(T *p_item) {
+		if (iterating) {
+			pending.push_back(p_item);
+			accessor.get_index(p_item) = INDEX_PENDING;
+			return;
+		}
+
+		_insert(p_item);
+	}
+
+	void remove(T *p_item) {
+		int &index_ref = accessor.get_index(p_item);
+		int index = index_ref;
+		index_ref = INDEX_NONE;
+
+		if (index == INDEX_PENDING) {
+			pending.erase(p_item);
+			return;
+		}
+		ERR_FAIL_COND(index < 0);
+
+		Bucket *bucket = _get_bucket(accessor.get_priority(p_item), false);
+		ERR_FAIL_COND(!bucket || index >= (int)bucket->items.size() || bucket->items[index] != p_item);
+		bucket->items[index] = nullptr;
+		bucket->has_removed = true;
+	}
+
+	// The item moved relative to the others, so its bucket is sorted again before the next iteration.
+	void order_changed(T *p_item) {
+		if (accessor.get_index(p_item) < 0) {
+			return;
+		}
+
+		Bucket *bucket = _get_bucket(accessor.get_priority(p_item), false);
+		if (bucket) {
+			bucket->sorted = false;
+		}
+	}
+
+	// Items are visited by bucket and index. An item removed during the iteration leaves a nullptr in its slot.
+	void begin_iteration() {
+		ERR_FAIL_COND(iterating);
+		_update();
+		iterating++;
+	}
+
+	void end_iteration() {
+		ERR_FAIL_COND(!iterating);
+		iterating--;
+
+		for (uint32_t i = 0; i < pending.size(); i++) {
+			_insert(pending[i]);
+		}
+		pending.clear();
+	}
+
+	bool is_iterating() const { return iterating > 0; }
+	uint32_t get_bucket_count() const { return buckets.size(); }
+	uint32_t get_bucket_size(uint32_t p_bucket) const { return buckets[p_bucket]->items.size(); }
+	T *get_item(uint32_t p_bucket, uint32_t p_index) const { return buckets[p_bucket]->items[p_index]; }
+
+	void set_accessor(const A &p_accessor) { accessor = p_accessor; }
+
+	~SceneTreeProcessList() {
+		for (uint32_t i = 0; i < buckets.size(); i++) {
+			memdelete(buckets[i]);
+		}
+	}
+};
+
 class SceneTreeTimer : public Reference {
 	GDCLASS(SceneTreeTimer, Reference);
 
 	float time_left = 0.0;
 	bool process_always = true;
 
+	SceneTree *tree = nullptr;
+	SceneTreeTimerHandle handle;
+
+	friend class SceneTree;
+	static void _timeout(Object *p_owner);
+
 protected:
 	static void _bind_methods();
 
@@ -77,6 +316,38 @@ class SceneTree : public MainLoop {
 public:
 	typedef void (*IdleCallback)();
 
+	enum ProcessListType {
+		PROCESS_LIST_PROCESS,
+		PROCESS_LIST_PHYSICS_PROCESS,
+		PROCESS_LIST_INTERNAL_PROCESS,
+		PROCESS_LIST_INTERNAL_PHYSICS_PROCESS,
+		PROCESS_LIST_MAX,
+	};
+
+	// Reads the process priority and the index of a node in one of the process lists.
+	struct ProcessListAccessor {
+		ProcessListType type = PROCESS_LIST_PROCESS;
+
+		int get_priority(const Node *p_node) const;
+		int &get_index(Node *p_node) const;
+		bool less(const Node *p_a, const Node *p_b) const;
+	};
+
+	typedef SceneTreeProcessList<Node, ProcessListAccessor> ProcessList;
+
+	enum {
+		PROCESS_LIST_INDEX_NONE = ProcessList::INDEX_NONE,
+		PROCESS_LIST_INDEX_PENDING = ProcessList::INDEX_PENDING,
+	};
+
+	enum TimerQueue {
+		TIMER_QUEUE_PROCESS,
+		TIMER_QUEUE_PHYSICS_PROCESS,
+		TIMER_QUEUE_SCENE_TREE,
+		TIMER_QUEUE_SCENE_TREE_PAUSABLE,
+		TIMER_QUEUE_MAX,
+	};
+
 private:
 	struct Group {
 		Vector<Node *> nodes;
@@ -130,7 +401,7 @@ private:
 	bool ugc_locked = false;
 	void _flush_ugc();
 
-	_FORCE_INLINE_ void _update_group_order(Group &g, bool p_use_priority = false);
+	_FORCE_INLINE_ void _update_group_order(Group &g);
 	void _update_listener();
 
 	Array _get_nodes_in_group(const StringName &p_group);
@@ -150,7 +421,13 @@ private:
 	void _change_scene(Node *p_to);
 	//void _call_group(uint32_t p_call_flags,const StringName& p_group,const StringName& p_function,const Variant& p_arg1,const Variant& p_arg2);
 
-	List<Ref<SceneTreeTimer>> timers;
+	// Timer nodes use the process queues, which advance even when paused, as they leave them on
+	// NOTIFICATION_PAUSED.
+	SceneTreeTimerScheduler timers = SceneTreeTimerScheduler(TIMER_QUEUE_MAX);
+	void _clear_timers();
+
+	friend class Timer;
+	friend class SceneTreeTimer;
 
 	///network///
 
@@ -176,7 +453,28 @@ private:
 	void remove_from_group(const StringName &p_group, Node *p_node);
 	void make_group_changed(const StringName &p_group);
 
-	void _notify_group_pause(const StringName &p_group, int p_notification);
+	// Nodes with process_threaded set, processed in parallel by chunks. Each chunk has its own
+	// message queue, moved to the main one in order afterwards, so deferred calls keep their order.
+	struct ThreadedProcess {
+		LocalVector<Node *> nodes;
+		uint32_t chunk_count = 0;
+		int notification = 0;
+	};
+
+	ThreadWorkPool process_thread_pool;
+	LocalVector<MessageQueue *> process_thread_queues;
+	ThreadedProcess threaded_process;
+
+	void _process_threaded_chunk(uint32_t p_chunk, ThreadedProcess *p_process);
+	void _notify_threaded(int p_notification);
+
+	// Nodes receiving each process notification, by priority and in tree order.
+	ProcessList process_lists[PROCESS_LIST_MAX];
+
+	void _add_to_process_list(ProcessListType p_type, Node *p_node);
+	void _remove_from_process_list(ProcessListType p_type, Node *p_node);
+	void _process_list_order_changed(Node *p_node);
+	void _notify_process_list(ProcessListType p_type, int p_notification);
 	Variant _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	Variant _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
@@ -186,8 +484,43 @@ private:
 	friend class Node3D;
 	friend class Viewport;
 
+	// Controls whose minimum size changed and containers that need sorting, resolved together in a single
+	// deferred flush: minimum sizes deepest first, so they only propagate up once, then sorts shallowest
+	// first, so a container is sorted after its parent resized it and not before. Each batch taken from either
+	// queue counts against LAYOUT_MAX_BATCHES, what is left after that waits for the next frame.
+	enum {
+		LAYOUT_MAX_BATCHES = 16,
+	};
+
+	LocalVector<ObjectID> layout_minimum_size_queue;
+	LocalVector<ObjectID> layout_sort_queue;
+	bool layout_flush_queued = false;
+	bool layout_flush_deferred = false;
+	uint32_t layout_sorts = 0;
+	uint64_t layout_usec = 0;
+	uint32_t last_frame_layout_sorts = 0;
+	uint64_t last_frame_layout_usec = 0;
+
+	friend class Control;
+	friend class Container;
+	void _queue_layout(ObjectID p_control, bool p_sort);
+	void _flush_layout();
+
 	SelfList<Node>::List xform_change_list;
 
+	// Server transforms set while transform notifications are flushed, sent in one call per server afterwards.
+	struct ServerTransforms {
+		LocalVector<RID> rids;
+		LocalVector<Transform> transforms;
+	};
+
+	int xform_flush_lock = 0;
+	ServerTransforms xform_instances;
+	ServerTransforms xform_bodies;
+
+	void _flush_server_transforms();
+	void _cancel_server_transform(ServerTransforms &p_queue, RID p_rid);
+
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
 #endif
@@ -234,6 +567,13 @@ public:
 	void set_group(const StringName &p_group, const String &p_name, const Variant &p_value);
 
 	void flush_transform_notifications();
+	// During flush_transform_notifications() these are only sent once every notification was delivered,
+	// so they reach the servers after any call a notification makes directly. Nodes leaving the world
+	// must cancel theirs before freeing or reusing the RID.
+	void set_instance_transform(RID p_instance, const Transform &p_transform);
+	void set_body_transform(RID p_body, const Transform &p_transform);
+	void cancel_instance_transform(RID p_instance);
+	void cancel_body_transform(RID p_body);
 
 	virtual void initialize() override;
 
@@ -299,6 +639,9 @@ public:
 
 	int get_node_count() const;
 
+	uint32_t get_layout_sort_count() const { return last_frame_layout_sorts; }
+	float get_layout_time() const { return last_frame_layout_usec / 1000000.0; }
+
 	void queue_delete(Object *p_object);
 
 	void get_nodes_in_group(const StringName &p_group, List<Node *> *p_list);
@@ -45,45 +45,30 @@ void Timer::_notification(int p_what) {
 				autostart = false;
 			}
 		} break;
-		case NOTIFICATION_INTERNAL_PROCESS: {
-			if (!processing || timer_process_callback == TIMER_PROCESS_PHYSICS || !is_processing_internal()) {
-				return;
-			}
-			time_left -= get_process_delta_time();
-
-			if (time_left < 0) {
-				if (!one_shot) {
-					time_left += wait_time;
-				} else {
-					stop();
-				}
-
-				emit_signal("timeout");
-			}
-
+		case NOTIFICATION_ENTER_TREE:
+		case NOTIFICATION_PAUSED:
+		case NOTIFICATION_UNPAUSED: {
+			_update_schedule();
 		} break;
-		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
-			if (!processing || timer_process_callback == TIMER_PROCESS_IDLE || !is_physics_processing_internal()) {
-				return;
-			}
-			time_left -= get_physics_process_delta_time();
-
-			if (time_left < 0) {
-				if (!one_shot) {
-					time_left += wait_time;
-				} else {
-					stop();
-				}
-				emit_signal("timeout");
-			}
-
+		case NOTIFICATION_EXIT_TREE: {
+			_update_schedule(false);
 		} break;
 	}
 }
 
+void Timer::_timeout(Object *p_owner) {
+	// Repeating timers are already rescheduled by the scheduler, see SceneTreeTimerHandle::repeat.
+	Timer *timer = static_cast<Timer *>(p_owner);
+	if (timer->one_shot) {
+		timer->stop();
+	}
+	timer->emit_signal("timeout");
+}
+
 void Timer::set_wait_time(float p_time) {
 	ERR_FAIL_COND_MSG(p_time <= 0, "Time should be greater than zero.");
 	wait_time = p_time;
+	handle.repeat = one_shot ? 0.0 : wait_time;
 }
 
 float Timer::get_wait_time() const {
@@ -92,6 +77,7 @@ float Timer::get_wait_time() const {
 
 void Timer::set_one_shot(bool p_one_shot) {
 	one_shot = p_one_shot;
+	handle.repeat = one_shot ? 0.0 : wait_time;
 }
 
 bool Timer::is_one_shot() const {
@@ -112,13 +98,14 @@ void Timer::start(float p_time) {
 	if (p_time > 0) {
 		set_wait_time(p_time);
 	}
+	get_tree()->timers.unschedule(&handle);
 	time_left = wait_time;
 	_set_process(true);
 }
 
 void Timer::stop() {
-	time_left = -1;
 	_set_process(false);
+	time_left = -1;
 	autostart = false;
 }
 
@@ -140,7 +127,11 @@ bool Timer::is_stopped() const {
 }
 
 float Timer::get_time_left() const {
-	return time_left > 0 ? time_left : 0;
+	double left = time_left;
+	if (handle.is_scheduled()) {
+		left = get_tree()->timers.get_time_left(&handle);
+	}
+	return left > 0 ? left : 0;
 }
 
 void Timer::set_timer_process_callback(TimerProcessCallback p_callback) {
@@ -148,37 +139,32 @@ void Timer::set_timer_process_callback(TimerProcessCallback p_callback) {
 		return;
 	}
 
-	switch (timer_process_callback) {
-		case TIMER_PROCESS_PHYSICS:
-			if (is_physics_processing_internal()) {
-				set_physics_process_internal(false);
-				set_process_internal(true);
-			}
-			break;
-		case TIMER_PROCESS_IDLE:
-			if (is_processing_internal()) {
-				set_process_internal(false);
-				set_physics_process_internal(true);
-			}
-			break;
-	}
 	timer_process_callback = p_callback;
+	_update_schedule();
 }
 
 Timer::TimerProcessCallback Timer::get_timer_process_callback() const {
 	return timer_process_callback;
 }
 
-void Timer::_set_process(bool p_process, bool p_force) {
-	switch (timer_process_callback) {
-		case TIMER_PROCESS_PHYSICS:
-			set_physics_process_internal(p_process && !paused);
-			break;
-		case TIMER_PROCESS_IDLE:
-			set_process_internal(p_process && !paused);
-			break;
-	}
+void Timer::_set_process(bool p_process) {
 	processing = p_process;
+	_update_schedule();
+}
+
+void Timer::_update_schedule(bool p_scheduled) {
+	if (!is_inside_tree()) {
+		return;
+	}
+
+	SceneTree *tree = get_tree();
+	if (handle.is_scheduled()) {
+		time_left = tree->timers.unschedule(&handle);
+	}
+
+	if (p_scheduled && processing && !paused && can_process()) {
+		tree->timers.schedule(&handle, timer_process_callback == TIMER_PROCESS_PHYSICS ? SceneTree::TIMER_QUEUE_PHYSICS_PROCESS : SceneTree::TIMER_QUEUE_PROCESS, time_left);
+	}
 }
 
 void Timer::_bind_methods() {
@@ -217,4 +203,8 @@ void Timer::_bind_methods() {
 	BIND_ENUM_CONSTANT(TIMER_PROCESS_IDLE);
 }
 
-Timer::Timer() {}
+Timer::Timer() {
+	handle.owner = this;
+	handle.timeout = &Timer::_timeout;
+	handle.repeat = wait_time;
+}
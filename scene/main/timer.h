@@ -44,6 +44,10 @@ class Timer : public Node {
 
 	double time_left = -1.0;
 
+	// Scheduled in the SceneTree while started, unpaused and processing.
+	SceneTreeTimerHandle handle;
+	static void _timeout(Object *p_owner);
+
 protected:
 	void _notification(int p_what);
 	static void _bind_methods();
@@ -79,7 +83,8 @@ public:
 
 private:
 	TimerProcessCallback timer_process_callback = TIMER_PROCESS_IDLE;
-	void _set_process(bool p_process, bool p_force = false);
+	void _set_process(bool p_process);
+	void _update_schedule(bool p_scheduled = true);
 };
 
 VARIANT_ENUM_CAST(Timer::TimerProcessCallback);
@@ -1490,6 +1490,7 @@ void Viewport::_gui_sort_roots() {
 	gui.roots.sort_custom<Control::CComparator>();
 
 	gui.roots_order_dirty = false;
+	gui.hit_test_dirty = true;
 }
 
 void Viewport::_gui_cancel_tooltip() {
@@ -1714,78 +1715,171 @@ void Viewport::_gui_call_notification(Control *p_control, int p_what) {
 Control *Viewport::_gui_find_control(const Point2 &p_global) {
 	//aca va subwindows
 	_gui_sort_roots();
+	if (gui.hit_test_dirty) {
+		_gui_update_hit_test();
+	}
 
-	for (List<Control *>::Element *E = gui.roots.back(); E; E = E->prev()) {
-		Control *sw = E->get();
-		if (!sw->is_visible_in_tree()) {
+	const GUIHitTestEntry *entries = gui.hit_test.ptr();
+	uint32_t entry_count = gui.hit_test.size();
+	Transform2D xform;
+	Point2 pos;
+
+	uint32_t i = 0;
+	while (i < entry_count) {
+		const GUIHitTestEntry &e = entries[i];
+
+		if (e.type == GUI_HIT_TEST_ROOT) {
+			Control *sw = e.control;
+			if (!sw->is_visible_in_tree()) {
+				i = e.skip;
+				continue;
+			}
+
+			CanvasItem *pci = sw->get_parent_item();
+			if (pci) {
+				xform = pci->get_global_transform_with_canvas();
+			} else {
+				xform = sw->get_canvas_transform();
+			}
+
+			// Nothing under this root exists on scene, see _gui_add_hit_test_entries().
+			if (xform.basis_determinant() == 0.0f) {
+				i = e.skip;
+				continue;
+			}
+
+			pos = xform.affine_inverse().xform(p_global);
+			i++;
 			continue;
 		}
 
-		Transform2D xform;
-		CanvasItem *pci = sw->get_parent_item();
-		if (pci) {
-			xform = pci->get_global_transform_with_canvas();
-		} else {
-			xform = sw->get_canvas_transform();
+		if (e.bounded && !e.bounds.has_point(pos)) {
+			i = e.skip;
+			continue;
 		}
 
-		Control *ret = _gui_find_control_at_pos(sw, p_global, xform, gui.focus_inv_xform);
-		if (ret) {
-			return ret;
+		if (e.type == GUI_HIT_TEST_GROUP) {
+			if (e.control && e.control->clips_input() && !e.control->has_point(e.inv_xform.xform(pos))) {
+				i = e.skip;
+			} else {
+				i++;
+			}
+			continue;
+		}
+
+		i++;
+
+		Control *c = e.control;
+		if (c->data.mouse_filter == Control::MOUSE_FILTER_IGNORE) {
+			continue;
+		}
+
+		if (!c->has_point(e.inv_xform.xform(pos))) {
+			continue;
+		}
+
+		Control *drag_preview = _gui_get_drag_preview();
+		if (!drag_preview || (c != drag_preview && !drag_preview->is_a_parent_of(c))) {
+			gui.focus_inv_xform = (xform * e.xform).affine_inverse();
+			return c;
 		}
 	}
 
 	return nullptr;
 }
 
-Control *Viewport::_gui_find_control_at_pos(CanvasItem *p_node, const Point2 &p_global, const Transform2D &p_xform, Transform2D &r_inv_xform) {
+bool Viewport::_gui_add_hit_test_entries(CanvasItem *p_node, const Transform2D &p_xform, Rect2 &r_bounds, bool &r_bounded) {
 	if (Object::cast_to<Viewport>(p_node)) {
-		return nullptr;
+		return false;
 	}
 
 	if (!p_node->is_visible()) {
-		//return _find_next_visible_control_at_pos(p_node,p_global,r_inv_xform);
-		return nullptr; //canvas item hidden, discard
+		return false; //canvas item hidden, discard
 	}
 
-	Transform2D matrix = p_xform * p_node->get_transform();
-	// matrix.basis_determinant() == 0.0f implies that node does not exist on scene
-	if (matrix.basis_determinant() == 0.0f) {
-		return nullptr;
+	Transform2D xform = p_xform * p_node->get_transform();
+	// xform.basis_determinant() == 0.0f implies that node does not exist on scene
+	if (xform.basis_determinant() == 0.0f) {
+		return false;
 	}
 
 	Control *c = Object::cast_to<Control>(p_node);
+	bool added = false;
+
+	// Children are picked before their parent, last child first.
+	uint32_t group_index = gui.hit_test.size();
+	GUIHitTestEntry group;
+	group.type = GUI_HIT_TEST_GROUP;
+	group.control = c;
+	group.xform = xform;
+	group.inv_xform = xform.affine_inverse();
+	gui.hit_test.push_back(group);
+
+	for (int i = p_node->get_child_count() - 1; i >= 0; i--) {
+		CanvasItem *ci = Object::cast_to<CanvasItem>(p_node->get_child(i));
+		if (!ci || ci->is_set_as_top_level()) {
+			continue;
+		}
 
-	if (!c || !c->clips_input() || c->has_point(matrix.affine_inverse().xform(p_global))) {
-		for (int i = p_node->get_child_count() - 1; i >= 0; i--) {
-			CanvasItem *ci = Object::cast_to<CanvasItem>(p_node->get_child(i));
-			if (!ci || ci->is_set_as_top_level()) {
-				continue;
-			}
-
-			Control *ret = _gui_find_control_at_pos(ci, p_global, matrix, r_inv_xform);
-			if (ret) {
-				return ret;
-			}
+		Rect2 child_bounds;
+		bool child_bounded;
+		if (!_gui_add_hit_test_entries(ci, xform, child_bounds, child_bounded)) {
+			continue;
 		}
+
+		r_bounds = added ? r_bounds.merge(child_bounds) : child_bounds;
+		r_bounded = added ? (r_bounded && child_bounded) : child_bounded;
+		added = true;
 	}
 
-	if (!c || c->data.mouse_filter == Control::MOUSE_FILTER_IGNORE) {
-		return nullptr;
+	bool has_group = added;
+	if (!has_group) {
+		gui.hit_test.resize(group_index);
 	}
 
-	matrix.affine_invert();
-	if (!c->has_point(matrix.xform(p_global))) {
-		return nullptr;
+	if (c) {
+		GUIHitTestEntry entry;
+		entry.control = c;
+		entry.xform = xform;
+		entry.inv_xform = has_group ? gui.hit_test[group_index].inv_xform : xform.affine_inverse();
+		entry.bounds = xform.xform(Rect2(Point2(), c->get_size()));
+		entry.bounded = c->is_hit_test_bounded();
+		entry.skip = gui.hit_test.size() + 1;
+		gui.hit_test.push_back(entry);
+
+		r_bounds = added ? r_bounds.merge(entry.bounds) : entry.bounds;
+		r_bounded = added ? (r_bounded && entry.bounded) : entry.bounded;
+		added = true;
 	}
 
-	Control *drag_preview = _gui_get_drag_preview();
-	if (!drag_preview || (c != drag_preview && !drag_preview->is_a_parent_of(c))) {
-		r_inv_xform = matrix;
-		return c;
+	if (has_group) {
+		GUIHitTestEntry &e = gui.hit_test[group_index];
+		e.bounds = r_bounds;
+		e.bounded = r_bounded;
+		e.skip = gui.hit_test.size();
 	}
 
-	return nullptr;
+	return added;
+}
+
+void Viewport::_gui_update_hit_test() {
+	gui.hit_test.clear();
+
+	for (List<Control *>::Element *E = gui.roots.back(); E; E = E->prev()) {
+		uint32_t root_index = gui.hit_test.size();
+		GUIHitTestEntry root;
+		root.type = GUI_HIT_TEST_ROOT;
+		root.control = E->get();
+		gui.hit_test.push_back(root);
+
+		// Entries are relative to the root's parent, whose transform is applied when picking.
+		Rect2 bounds;
+		bool bounded;
+		_gui_add_hit_test_entries(E->get(), Transform2D(), bounds, bounded);
+		gui.hit_test[root_index].skip = gui.hit_test.size();
+	}
+
+	gui.hit_test_dirty = false;
 }
 
 bool Viewport::_gui_drop(Control *p_at_control, Point2 p_at_pos, bool p_just_check) {
@@ -2487,6 +2581,7 @@ Control *Viewport::_gui_get_drag_preview() {
 
 void Viewport::_gui_remove_root_control(List<Control *>::Element *RI) {
 	gui.roots.erase(RI);
+	gui.hit_test_dirty = true;
 }
 
 void Viewport::_gui_unfocus_control(Control *p_control) {
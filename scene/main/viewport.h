@@ -32,6 +32,7 @@
 #define VIEWPORT_H
 
 #include "core/math/transform_2d.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 #include "scene/resources/texture.h"
 #include "scene/resources/world_2d.h"
@@ -336,6 +337,25 @@ private:
 		RID canvas_item;
 	};
 
+	// Flattened copy of the GUI roots' subtrees, in picking order (front to back), so mouse picking
+	// doesn't need to walk the tree and invert transforms for every node. Groups cover the subtree
+	// of an item with children and are skipped as a whole when the point falls outside its bounds.
+	enum GUIHitTestType {
+		GUI_HIT_TEST_ROOT,
+		GUI_HIT_TEST_GROUP,
+		GUI_HIT_TEST_CONTROL,
+	};
+
+	struct GUIHitTestEntry {
+		GUIHitTestType type = GUI_HIT_TEST_CONTROL;
+		Control *control = nullptr;
+		Rect2 bounds; // In the space of the root's parent item.
+		bool bounded = true; // False when has_point() may accept points outside the rect.
+		Transform2D xform;
+		Transform2D inv_xform;
+		uint32_t skip = 0; // Index of the first entry past this one and its subtree.
+	};
+
 	struct GUI {
 		// info used when this is a window
 
@@ -363,6 +383,8 @@ private:
 		Transform2D focus_inv_xform;
 		bool roots_order_dirty = false;
 		List<Control *> roots;
+		LocalVector<GUIHitTestEntry> hit_test;
+		bool hit_test_dirty = true;
 		int canvas_sort_index = 0; //for sorting items with canvas as root
 		bool dragging = false;
 		bool embed_subwindows_hint = false;
@@ -390,7 +412,9 @@ private:
 
 	void _gui_sort_roots();
 	Control *_gui_find_control(const Point2 &p_global);
-	Control *_gui_find_control_at_pos(CanvasItem *p_node, const Point2 &p_global, const Transform2D &p_xform, Transform2D &r_inv_xform);
+	bool _gui_add_hit_test_entries(CanvasItem *p_node, const Transform2D &p_xform, Rect2 &r_bounds, bool &r_bounded);
+	void _gui_update_hit_test();
+	_FORCE_INLINE_ void _gui_hit_test_changed() { gui.hit_test_dirty = true; }
 
 	void _gui_input_event(Ref<InputEvent> p_event);
 
@@ -400,6 +424,7 @@ private:
 
 	Ref<InputEvent> _make_input_local(const Ref<InputEvent> &ev);
 
+	friend class CanvasItem;
 	friend class Control;
 
 	List<Control *>::Element *_gui_add_root_control(Control *p_control);
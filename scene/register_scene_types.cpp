@@ -152,6 +152,7 @@
 #include "scene/resources/mesh_data_tool.h"
 #include "scene/resources/navigation_mesh.h"
 #include "scene/resources/packed_scene.h"
+#include "scene/resources/packed_scene_pool.h"
 #include "scene/resources/particles_material.h"
 #include "scene/resources/physics_material.h"
 #include "scene/resources/polygon_path_finder.h"
@@ -799,6 +800,7 @@ void register_scene_types() {
 
 	ClassDB::register_virtual_class<SceneState>();
 	ClassDB::register_class<PackedScene>();
+	ClassDB::register_class<PackedScenePool>();
 
 	ClassDB::register_class<SceneTree>();
 	ClassDB::register_virtual_class<SceneTreeTimer>(); //sorry, you can't create it
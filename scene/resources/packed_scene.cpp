@@ -78,6 +78,15 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 
 	const NodeData *nd = &nodes[0];
 
+	// The plan is only used at runtime, the editor must go through Object::set() to track edits.
+	const InstancePlan *plan = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED) {
+		if (!instance_plan_ready.is_set()) {
+			_build_instance_plan();
+		}
+		plan = instance_plan.ptr();
+	}
+
 	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
 
 	bool gen_node_path_cache = p_edit_state != GEN_EDIT_STATE_DISABLED && node_path_cache.is_empty();
@@ -150,7 +159,9 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 		} else {
 			Object *obj = nullptr;
 
-			if (ClassDB::is_class_enabled(snames[n.type])) {
+			if (plan && plan[i].creation_func) {
+				obj = plan[i].creation_func();
+			} else if (ClassDB::is_class_enabled(snames[n.type])) {
 				//node belongs to this scene and must be created
 				obj = ClassDB::instance(snames[n.type]);
 			}
@@ -188,6 +199,12 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 			if (nprop_count) {
 				const NodeData::Property *nprops = &n.properties[0];
 
+				// Setters resolved in the plan bypass the script instance, so they can only be used without one.
+				const ClassDB::PropertySetGet *const *setters = nullptr;
+				if (plan && plan[i].setters.size() && node->get_class_name() == plan[i].class_name) {
+					setters = plan[i].setters.ptr();
+				}
+
 				for (int j = 0; j < nprop_count; j++) {
 					bool valid;
 					ERR_FAIL_INDEX_V(nprops[j].name, sname_count, nullptr);
@@ -244,7 +261,12 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 						} else if (p_edit_state == GEN_EDIT_STATE_INSTANCE) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor
 						}
-						node->set(snames[nprops[j].name], value, &valid);
+
+						if (setters && setters[j] && !node->get_script_instance()) {
+							ClassDB::set_property(node, setters[j], value, &valid);
+						} else {
+							node->set(snames[nprops[j].name], value, &valid);
+						}
 					}
 				}
 			}
@@ -346,6 +368,90 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 	return ret_nodes[0];
 }
 
+StringName SceneState::_get_root_class() const {
+	const SceneState *state = this;
+	// Keep the states alive while following inherited and instanced roots.
+	Ref<SceneState> state_ref;
+
+	while (state->nodes.size()) {
+		const NodeData &root = state->nodes[0];
+		int scene_idx = -1;
+
+		if (state->base_scene_idx >= 0) {
+			scene_idx = state->base_scene_idx;
+		} else if (root.instance >= 0 && !(root.instance & FLAG_INSTANCE_IS_PLACEHOLDER)) {
+			scene_idx = root.instance & FLAG_MASK;
+		} else if (root.type != TYPE_INSTANCED && root.type >= 0 && root.type < state->names.size()) {
+			return state->names[root.type];
+		} else {
+			break;
+		}
+
+		ERR_FAIL_INDEX_V(scene_idx, state->variants.size(), StringName());
+		Ref<PackedScene> scene = state->variants[scene_idx];
+		if (scene.is_null()) {
+			break;
+		}
+		state_ref = scene->get_state();
+		state = state_ref.ptr();
+	}
+
+	return StringName();
+}
+
+void SceneState::_build_instance_plan() const {
+	MutexLock lock(instance_plan_mutex);
+
+	if (instance_plan_ready.is_set()) {
+		return; // Built by another thread in the meantime.
+	}
+
+	instance_plan.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		InstancePlan &node_plan = instance_plan[i];
+
+		node_plan.class_name = StringName();
+		node_plan.creation_func = nullptr;
+		node_plan.setters.clear();
+
+		if (i == 0 && base_scene_idx >= 0) {
+			node_plan.class_name = _get_root_class();
+		} else if (n.instance >= 0) {
+			if (!(n.instance & FLAG_INSTANCE_IS_PLACEHOLDER) && (n.instance & FLAG_MASK) < variants.size()) {
+				Ref<PackedScene> scene = variants[n.instance & FLAG_MASK];
+				if (scene.is_valid()) {
+					node_plan.class_name = scene->get_state()->_get_root_class();
+				}
+			}
+		} else if (n.type != TYPE_INSTANCED && n.type >= 0 && n.type < names.size()) {
+			node_plan.class_name = names[n.type];
+			node_plan.creation_func = ClassDB::get_creation_func(node_plan.class_name);
+		}
+		// Nodes of instanced scenes that are only modified here are looked up by name,
+		// their class is not known until then and their properties are set through Object::set().
+
+		if (node_plan.class_name == StringName() || n.properties.is_empty()) {
+			continue;
+		}
+
+		node_plan.setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			int name_idx = n.properties[j].name;
+			node_plan.setters[j] = name_idx >= 0 && name_idx < names.size() ? ClassDB::get_property_setget(node_plan.class_name, names[name_idx]) : nullptr;
+		}
+	}
+
+	instance_plan_ready.set();
+}
+
+void SceneState::_clear_instance_plan() {
+	MutexLock lock(instance_plan_mutex);
+	instance_plan.clear();
+	instance_plan_ready.clear();
+}
+
 static int _nm_get_string(const String &p_string, Map<StringName, int> &name_map) {
 	if (name_map.has(p_string)) {
 		return name_map[p_string];
@@ -905,6 +1011,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instance_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1068,6 +1175,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	_clear_instance_plan();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -1505,6 +1614,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_clear_instance_plan();
 	nodes.push_back(nd);
 
 	return nodes.size() - 1;
@@ -1518,6 +1628,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value) {
 	NodeData::Property prop;
 	prop.name = p_name;
 	prop.value = p_value;
+	_clear_instance_plan();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -1529,6 +1640,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_clear_instance_plan();
 	base_scene_idx = p_idx;
 }
 
@@ -32,6 +32,10 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/object/class_db.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
 class SceneState : public Reference {
@@ -87,6 +91,23 @@ class SceneState : public Reference {
 
 	Vector<ConnectionData> connections;
 
+	// What instance() can resolve once instead of for every node it creates:
+	// the creation function of the node type and the setter of each property,
+	// which are only valid while the created node is of the class they were resolved for.
+	struct InstancePlan {
+		StringName class_name;
+		Object *(*creation_func)() = nullptr;
+		LocalVector<const ClassDB::PropertySetGet *> setters;
+	};
+
+	mutable LocalVector<InstancePlan> instance_plan;
+	mutable SafeFlag instance_plan_ready;
+	mutable Mutex instance_plan_mutex;
+
+	StringName _get_root_class() const;
+	void _build_instance_plan() const;
+	void _clear_instance_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, Map<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, Map<Node *, int> &node_map, Map<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, Map<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, Map<Node *, int> &node_map, Map<Node *, int> &nodepath_map);
 
@@ -0,0 +1,241 @@
+/*************************************************************************/
+/*  packed_scene_pool.cpp                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "packed_scene_pool.h"
+
+#include "scene/main/scene_tree.h"
+
+uint64_t PackedScenePool::total_hit_count = 0;
+uint64_t PackedScenePool::total_miss_count = 0;
+
+void PackedScenePool::_record_default_state(Node *p_root, Node *p_node) {
+	NodeState state;
+	state.path = p_root->get_path_to(p_node);
+
+	List<PropertyInfo> plist;
+	p_node->get_property_list(&plist);
+	for (List<PropertyInfo>::Element *E = plist.front(); E; E = E->next()) {
+		const PropertyInfo &pi = E->get();
+		if (!(pi.usage & PROPERTY_USAGE_STORAGE) || pi.name == "script" || pi.name == "name") {
+			continue;
+		}
+
+		Variant value = p_node->get(pi.name);
+		Ref<Resource> res = value;
+		if (res.is_valid() && res->is_local_to_scene()) {
+			continue; // Owned by this instance, keep it.
+		}
+		if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+			// The instance is handed out as well, don't let it modify the recorded values.
+			value = value.duplicate(true);
+		}
+		state.properties.push_back(Pair<StringName, Variant>(pi.name, value));
+	}
+
+	default_state.push_back(state);
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_record_default_state(p_root, p_node->get_child(i));
+	}
+}
+
+void PackedScenePool::_reset(Node *p_instance) {
+	for (uint32_t i = 0; i < default_state.size(); i++) {
+		const NodeState &state = default_state[i];
+		Node *node = i == 0 ? p_instance : p_instance->get_node_or_null(state.path);
+		if (!node) {
+			continue; // Removed while in use.
+		}
+
+		for (uint32_t j = 0; j < state.properties.size(); j++) {
+			const Variant &value = state.properties[j].second;
+			if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+				// Don't let instances share and modify the recorded values.
+				node->set(state.properties[j].first, value.duplicate(true));
+			} else {
+				node->set(state.properties[j].first, value);
+			}
+		}
+	}
+}
+
+Node *PackedScenePool::_instance() {
+	Node *instance = scene->instance();
+	ERR_FAIL_NULL_V(instance, nullptr);
+
+	if (default_state.is_empty()) {
+		_record_default_state(instance, instance);
+	}
+	return instance;
+}
+
+void PackedScenePool::_clear() {
+	for (uint32_t i = 0; i < available.size(); i++) {
+		memdelete(available[i]);
+	}
+	available.clear();
+	acquired.clear();
+	default_state.clear();
+}
+
+void PackedScenePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (p_scene == scene) {
+		return;
+	}
+	_clear();
+	scene = p_scene;
+}
+
+Ref<PackedScene> PackedScenePool::get_scene() const {
+	return scene;
+}
+
+void PackedScenePool::set_growth_step(int p_step) {
+	ERR_FAIL_COND(p_step < 1);
+	growth_step = p_step;
+}
+
+int PackedScenePool::get_growth_step() const {
+	return growth_step;
+}
+
+void PackedScenePool::set_max_size(int p_size) {
+	ERR_FAIL_COND(p_size < 0);
+	max_size = p_size;
+
+	while (max_size > 0 && (int)available.size() > max_size) {
+		memdelete(available[available.size() - 1]);
+		available.resize(available.size() - 1);
+	}
+}
+
+int PackedScenePool::get_max_size() const {
+	return max_size;
+}
+
+void PackedScenePool::warm_up(int p_count) {
+	ERR_FAIL_COND_MSG(scene.is_null(), "No scene set to instance.");
+
+	if (max_size > 0) {
+		p_count = MIN(p_count, max_size);
+	}
+
+	while ((int)available.size() < p_count) {
+		Node *instance = _instance();
+		if (!instance) {
+			return;
+		}
+		available.push_back(instance);
+	}
+}
+
+Node *PackedScenePool::acquire() {
+	Node *instance = nullptr;
+
+	if (available.size()) {
+		hit_count++;
+		total_hit_count++;
+		instance = available[available.size() - 1];
+		available.resize(available.size() - 1);
+	} else {
+		ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "No scene set to instance.");
+		miss_count++;
+		total_miss_count++;
+		instance = _instance();
+		ERR_FAIL_NULL_V(instance, nullptr);
+		// Grow ahead, so the next acquisitions don't miss as well.
+		warm_up(growth_step - 1);
+	}
+
+	acquired.insert(instance->get_instance_id());
+	return instance;
+}
+
+void PackedScenePool::release(Node *p_instance) {
+	ERR_FAIL_NULL(p_instance);
+	ERR_FAIL_COND_MSG(!acquired.has(p_instance->get_instance_id()), "The node was not acquired from this pool, or was already released.");
+	ERR_FAIL_COND_MSG(p_instance->is_queued_for_deletion(), "The node is queued for deletion and can't be reused.");
+
+	acquired.erase(p_instance->get_instance_id());
+
+	if (p_instance->get_parent()) {
+		p_instance->get_parent()->remove_child(p_instance);
+	}
+
+	if (max_size > 0 && (int)available.size() >= max_size) {
+		// Instances are commonly released from their own signals or callbacks, so they can't be freed right away.
+		if (SceneTree::get_singleton()) {
+			p_instance->queue_delete();
+		} else {
+			memdelete(p_instance);
+		}
+		return;
+	}
+
+	_reset(p_instance);
+	available.push_back(p_instance);
+}
+
+int PackedScenePool::get_available_count() const {
+	return available.size();
+}
+
+uint64_t PackedScenePool::get_hit_count() const {
+	return hit_count;
+}
+
+uint64_t PackedScenePool::get_miss_count() const {
+	return miss_count;
+}
+
+void PackedScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &PackedScenePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &PackedScenePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_growth_step", "step"), &PackedScenePool::set_growth_step);
+	ClassDB::bind_method(D_METHOD("get_growth_step"), &PackedScenePool::get_growth_step);
+	ClassDB::bind_method(D_METHOD("set_max_size", "size"), &PackedScenePool::set_max_size);
+	ClassDB::bind_method(D_METHOD("get_max_size"), &PackedScenePool::get_max_size);
+
+	ClassDB::bind_method(D_METHOD("warm_up", "count"), &PackedScenePool::warm_up);
+	ClassDB::bind_method(D_METHOD("acquire"), &PackedScenePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "instance"), &PackedScenePool::release);
+
+	ClassDB::bind_method(D_METHOD("get_available_count"), &PackedScenePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("get_hit_count"), &PackedScenePool::get_hit_count);
+	ClassDB::bind_method(D_METHOD("get_miss_count"), &PackedScenePool::get_miss_count);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "growth_step", PROPERTY_HINT_RANGE, "1,256,1,or_greater"), "set_growth_step", "get_growth_step");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_max_size", "get_max_size");
+}
+
+PackedScenePool::~PackedScenePool() {
+	_clear();
+}
@@ -0,0 +1,95 @@
+/*************************************************************************/
+/*  packed_scene_pool.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef PACKED_SCENE_POOL_H
+#define PACKED_SCENE_POOL_H
+
+#include "core/templates/local_vector.h"
+#include "core/templates/set.h"
+#include "scene/resources/packed_scene.h"
+
+class PackedScenePool : public Reference {
+	GDCLASS(PackedScenePool, Reference);
+
+	Ref<PackedScene> scene;
+	int growth_step = 1;
+	int max_size = 0;
+
+	// Stored properties of a freshly instanced scene, restored when an instance is released.
+	struct NodeState {
+		NodePath path;
+		LocalVector<Pair<StringName, Variant>> properties;
+	};
+	LocalVector<NodeState> default_state;
+
+	LocalVector<Node *> available;
+	Set<ObjectID> acquired;
+
+	uint64_t hit_count = 0;
+	uint64_t miss_count = 0;
+
+	static uint64_t total_hit_count;
+	static uint64_t total_miss_count;
+
+	void _record_default_state(Node *p_root, Node *p_node);
+	void _reset(Node *p_instance);
+	Node *_instance();
+	void _clear();
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_scene(const Ref<PackedScene> &p_scene);
+	Ref<PackedScene> get_scene() const;
+
+	void set_growth_step(int p_step);
+	int get_growth_step() const;
+
+	void set_max_size(int p_size);
+	int get_max_size() const;
+
+	void warm_up(int p_count);
+
+	Node *acquire();
+	void release(Node *p_instance);
+
+	int get_available_count() const;
+	uint64_t get_hit_count() const;
+	uint64_t get_miss_count() const;
+
+	static uint64_t get_total_hit_count() { return total_hit_count; }
+	static uint64_t get_total_miss_count() { return total_miss_count; }
+
+	PackedScenePool() {}
+	~PackedScenePool();
+};
+
+#endif // PACKED_SCENE_POOL_H
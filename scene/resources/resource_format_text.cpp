@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/io/resource_format_binary.h"
 #include "core/os/dir_access.h"
+#include "core/os/thread.h"
 #include "core/version.h"
 
 //version 2: changed names for basis, aabb, Vectors, etc.
@@ -1262,13 +1263,33 @@ RES ResourceFormatLoaderText::load(const String &p_path, const String &p_origina
 	}
 
 	Error err;
+	String path = p_original_path != "" ? p_original_path : p_path;
+
+#ifdef TOOLS_ENABLED
+	// Optionally load the binary version of the file, converted the last time it was loaded.
+	String cache_path;
+	String source_md5;
+	if (GLOBAL_GET("editor/import/use_binary_cache_for_text_resources")) {
+		cache_path = ProjectSettings::IMPORTED_FILES_PATH.plus_file(p_path.get_file() + "-" + p_path.md5_text());
+		source_md5 = FileAccess::get_md5(p_path);
+
+		if (FileAccess::exists(cache_path + ".md5") && FileAccess::get_file_as_string(cache_path + ".md5") == source_md5) {
+			RES res = ResourceFormatLoaderBinary::singleton->load(cache_path + ".res", path, &err, p_use_sub_threads, r_progress, p_cache_mode);
+			if (err == OK) {
+				if (r_error) {
+					*r_error = OK;
+				}
+				return res;
+			}
+		}
+	}
+#endif
 
 	FileAccess *f = FileAccess::open(p_path, FileAccess::READ, &err);
 
 	ERR_FAIL_COND_V_MSG(err != OK, RES(), "Cannot open file '" + p_path + "'.");
 
 	ResourceLoaderText loader;
-	String path = p_original_path != "" ? p_original_path : p_path;
 	loader.cache_mode = p_cache_mode;
 	loader.use_sub_threads = p_use_sub_threads;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
@@ -1280,11 +1301,27 @@ RES ResourceFormatLoaderText::load(const String &p_path, const String &p_origina
 	if (r_error) {
 		*r_error = err;
 	}
-	if (err == OK) {
-		return loader.get_resource();
-	} else {
+	if (err != OK) {
 		return RES();
 	}
+
+#ifdef TOOLS_ENABLED
+	if (cache_path != String() && source_md5 != String()) {
+		// Converted to a temporary file first, so other threads never load a partial one.
+		String tmp_path = cache_path + ".tmp" + itos(Thread::get_caller_id());
+		DirAccessRef da = DirAccess::create(DirAccess::ACCESS_RESOURCES);
+		if (convert_file_to_binary(p_path, tmp_path) == OK && da->rename(tmp_path, cache_path + ".res") == OK) {
+			FileAccessRef md5_file = FileAccess::open(cache_path + ".md5", FileAccess::WRITE);
+			if (md5_file) {
+				md5_file->store_string(source_md5);
+			}
+		} else if (da->file_exists(tmp_path)) {
+			da->remove(tmp_path);
+		}
+	}
+#endif
+
+	return loader.get_resource();
 }
 
 void ResourceFormatLoaderText::get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const {
@@ -1354,6 +1391,7 @@ Error ResourceFormatLoaderText::rename_dependencies(const String &p_path, const
 	ResourceLoaderText loader;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(p_path);
 	loader.res_path = loader.local_path;
+	loader.stream.readahead_enabled = false; // The rest of the file is copied from where the tags end.
 	//loader.set_local_path( ProjectSettings::get_singleton()->localize_path(p_path) );
 	return loader.rename_dependencies(f, p_path, p_map);
 }
@@ -217,6 +217,7 @@ public:
 	FUNC1RC(real_t, body_get_kinematic_safe_margin, RID);
 
 	FUNC3(body_set_state, RID, BodyState, const Variant &);
+	FUNC2(bodies_set_transform, const Vector<RID> &, const Vector<Transform> &);
 	FUNC2RC(Variant, body_get_state, RID, BodyState);
 
 	FUNC2(body_set_applied_force, RID, const Vector3 &);
@@ -425,6 +425,16 @@ RID PhysicsServer3D::shape_create(ShapeType p_shape) {
 	}
 }
 
+void PhysicsServer3D::bodies_set_transform(const Vector<RID> &p_bodies, const Vector<Transform> &p_transforms) {
+	ERR_FAIL_COND(p_bodies.size() != p_transforms.size());
+
+	const RID *bodies = p_bodies.ptr();
+	const Transform *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_bodies.size(); i++) {
+		body_set_state(bodies[i], BODY_STATE_TRANSFORM, transforms[i]);
+	}
+}
+
 void PhysicsServer3D::_bind_methods() {
 #ifndef _3D_DISABLED
 
@@ -443,6 +443,9 @@ public:
 	virtual void body_set_state(RID p_body, BodyState p_state, const Variant &p_variant) = 0;
 	virtual Variant body_get_state(RID p_body, BodyState p_state) const = 0;
 
+	// Sets BODY_STATE_TRANSFORM on many bodies in one call, see SceneTree::flush_transform_notifications().
+	virtual void bodies_set_transform(const Vector<RID> &p_bodies, const Vector<Transform> &p_transforms);
+
 	//do something about it
 	virtual void body_set_applied_force(RID p_body, const Vector3 &p_force) = 0;
 	virtual Vector3 body_get_applied_force(RID p_body) const = 0;
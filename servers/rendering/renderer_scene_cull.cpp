@@ -732,6 +732,16 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform &
 	_instance_queue_update(instance, true);
 }
 
+void RendererSceneCull::instances_set_transform(const Vector<RID> &p_instances, const Vector<Transform> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	const RID *instances = p_instances.ptr();
+	const Transform *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		instance_set_transform(instances[i], transforms[i]);
+	}
+}
+
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.getornull(p_instance);
 	ERR_FAIL_COND(!instance);
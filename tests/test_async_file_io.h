@@ -0,0 +1,82 @@
+/*************************************************************************/
+/*  test_async_file_io.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_ASYNC_FILE_IO_H
+#define TEST_ASYNC_FILE_IO_H
+
+#include "core/io/async_file_io.h"
+#include "core/os/dir_access.h"
+#include "core/os/os.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestAsyncFileIO {
+
+TEST_CASE("[AsyncFileIO] Write, append and read back a file") {
+	const String path = OS::get_singleton()->get_cache_path().plus_file("async_file_io.bin");
+
+	Vector<uint8_t> data;
+	data.resize(100000);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = i % 253;
+	}
+
+	Ref<AsyncFileRequest> write = AsyncFileIO::get_singleton()->write(path, data);
+	CHECK_MESSAGE(write->wait() == OK, "Writing the file should succeed.");
+	CHECK(write->is_completed());
+
+	Vector<uint8_t> extra;
+	extra.push_back(42);
+	CHECK_MESSAGE(
+			AsyncFileIO::get_singleton()->write(path, extra, true)->wait() == OK,
+			"Appending to the file should succeed.");
+
+	Ref<AsyncFileRequest> read = AsyncFileIO::get_singleton()->read(path);
+	REQUIRE(read->wait() == OK);
+	Vector<uint8_t> read_data = read->get_data();
+	REQUIRE(read_data.size() == data.size() + 1);
+	CHECK_MESSAGE(read_data.subarray(0, data.size() - 1) == data, "The whole file should be read back.");
+	CHECK_MESSAGE(read_data[data.size()] == 42, "The appended data should be at the end.");
+
+	Ref<AsyncFileRequest> read_part = AsyncFileIO::get_singleton()->read(path, 1000, 10);
+	REQUIRE(read_part->wait() == OK);
+	CHECK_MESSAGE(read_part->get_data() == data.subarray(1000, 1009), "Reading part of the file should return just that part.");
+
+	DirAccess::remove_file_or_error(path);
+}
+
+TEST_CASE("[AsyncFileIO] Reading a missing file fails") {
+	Ref<AsyncFileRequest> read = AsyncFileIO::get_singleton()->read(OS::get_singleton()->get_cache_path().plus_file("async_file_io_missing.bin"));
+	CHECK(read->wait() != OK);
+	CHECK(read->get_data().is_empty());
+}
+} // namespace TestAsyncFileIO
+
+#endif // TEST_ASYNC_FILE_IO_H
@@ -52,6 +52,27 @@ TEST_CASE("[LocalVector] Push Back.") {
 	CHECK(vector[4] == 4);
 }
 
+TEST_CASE("[LocalVector] Insert.") {
+	LocalVector<int> vector;
+	vector.push_back(0);
+	vector.push_back(1);
+	vector.push_back(2);
+	vector.push_back(3);
+
+	vector.insert(1, 4);
+	vector.insert(0, 5);
+	vector.insert(vector.size(), 6);
+
+	CHECK(vector.size() == 7);
+	CHECK(vector[0] == 5);
+	CHECK(vector[1] == 0);
+	CHECK(vector[2] == 4);
+	CHECK(vector[3] == 1);
+	CHECK(vector[4] == 2);
+	CHECK(vector[5] == 3);
+	CHECK(vector[6] == 6);
+}
+
 TEST_CASE("[LocalVector] Find.") {
 	LocalVector<int> vector;
 	vector.push_back(3);
@@ -35,6 +35,7 @@
 #include "test_aabb.h"
 #include "test_array.h"
 #include "test_astar.h"
+#include "test_async_file_io.h"
 #include "test_basis.h"
 #include "test_class_db.h"
 #include "test_color.h"
@@ -57,10 +58,13 @@
 #include "test_marshalls.h"
 #include "test_math.h"
 #include "test_method_bind.h"
+#include "test_node.h"
 #include "test_node_path.h"
 #include "test_oa_hash_map.h"
 #include "test_object.h"
 #include "test_ordered_hash_map.h"
+#include "test_packed_scene.h"
+#include "test_packed_scene_pool.h"
 #include "test_paged_array.h"
 #include "test_pck_packer.h"
 #include "test_physics_2d.h"
@@ -69,6 +73,8 @@
 #include "test_rect2.h"
 #include "test_render.h"
 #include "test_resource.h"
+#include "test_scene_tree_process_list.h"
+#include "test_scene_tree_timer.h"
 #include "test_shader_lang.h"
 #include "test_string.h"
 #include "test_text_server.h"
@@ -0,0 +1,181 @@
+/*************************************************************************/
+/*  test_node.h                                                          */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_NODE_H
+#define TEST_NODE_H
+
+#include "scene/main/node.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode {
+
+TEST_CASE("[Node] Resolve paths through wide parents") {
+	Node *root = memnew(Node);
+	root->set_name("Root");
+
+	// Enough children for the parent to index them by name.
+	for (int i = 0; i < 100; i++) {
+		Node *child = memnew(Node);
+		child->set_name("Child" + itos(i));
+		root->add_child(child);
+
+		Node *grandchild = memnew(Node);
+		grandchild->set_name("Grandchild");
+		child->add_child(grandchild);
+	}
+
+	Node *child = root->get_child(42);
+	CHECK(root->get_node_or_null(NodePath("Child42")) == child);
+	CHECK(root->get_node_or_null(NodePath("Child42/Grandchild")) == child->get_child(0));
+	CHECK(child->get_child(0)->get_node_or_null(NodePath("../../Child7")) == root->get_child(7));
+	CHECK(root->get_node_or_null(NodePath("Child100")) == nullptr);
+
+	child->set_name("Renamed");
+	CHECK(root->get_node_or_null(NodePath("Child42")) == nullptr);
+	CHECK(root->get_node_or_null(NodePath("Renamed")) == child);
+
+	root->remove_child(child);
+	CHECK(root->get_node_or_null(NodePath("Renamed")) == nullptr);
+	CHECK(root->get_child_count() == 99);
+
+	// A name that is taken by a sibling is made unique.
+	child->set_name("Child7");
+	root->add_child(child);
+	CHECK(child->get_name() != StringName("Child7"));
+	CHECK(root->get_node_or_null(NodePath("Child7")) == root->get_child(7));
+	CHECK(root->get_node_or_null(NodePath(child->get_name())) == child);
+
+	memdelete(root);
+}
+
+TEST_CASE("[Node] Resolved paths are not kept after the tree changes") {
+	Node *root = memnew(Node);
+	Node *a = memnew(Node);
+	a->set_name("A");
+	root->add_child(a);
+	Node *b = memnew(Node);
+	b->set_name("B");
+	a->add_child(b);
+
+	const NodePath path("A/B");
+	CHECK(root->get_node_or_null(path) == b);
+	CHECK(root->get_node_or_null(path) == b);
+
+	a->remove_child(b);
+	CHECK(root->get_node_or_null(path) == nullptr);
+
+	Node *c = memnew(Node);
+	c->set_name("B");
+	a->add_child(c);
+	CHECK(root->get_node_or_null(path) == c);
+
+	a->set_name("Other");
+	CHECK(root->get_node_or_null(path) == nullptr);
+
+	memdelete(b);
+	memdelete(root);
+}
+
+TEST_CASE("[Node] Spawn and despawn many siblings with the same name") {
+	Node *root = memnew(Node);
+
+	Vector<Node *> spawned;
+	Set<StringName> names;
+	for (int i = 0; i < 200; i++) {
+		Node *child = memnew(Node);
+		child->set_name("Spawn");
+		root->add_child(child);
+		spawned.push_back(child);
+		names.insert(child->get_name());
+	}
+	CHECK(names.size() == 200);
+
+	// Remove every other node, the rest keep their order.
+	for (int i = 0; i < 200; i += 2) {
+		root->remove_child(spawned[i]);
+		memdelete(spawned[i]);
+	}
+	CHECK(root->get_child_count() == 100);
+	for (int i = 0; i < 100; i++) {
+		Node *child = root->get_child(i);
+		CHECK(child == spawned[i * 2 + 1]);
+		CHECK(child->get_index() == i);
+		CHECK(root->get_node_or_null(NodePath(child->get_name())) == child);
+	}
+
+	memdelete(root);
+}
+
+TEST_CASE("[Node] Human readable names for many siblings with the same name") {
+	Node::set_human_readable_collision_renaming(true);
+	Node *root = memnew(Node);
+
+	Vector<Node *> spawned;
+	Set<StringName> names;
+	for (int i = 0; i < 300; i++) {
+		Node *child = memnew(Node);
+		child->set_name("Spawn");
+		root->add_child(child);
+		spawned.push_back(child);
+		names.insert(child->get_name());
+	}
+	CHECK(names.size() == 300);
+	CHECK(spawned[0]->get_name() == StringName("Spawn"));
+
+	// The lowest free suffix is used again once its node is removed.
+	const StringName freed = spawned[4]->get_name();
+	root->remove_child(spawned[4]);
+	memdelete(spawned[4]);
+
+	Node *child = memnew(Node);
+	child->set_name("Spawn");
+	root->add_child(child);
+	CHECK(child->get_name() == freed);
+
+	child = memnew(Node);
+	child->set_name("Spawn");
+	root->add_child(child);
+	CHECK(!names.has(child->get_name()));
+	CHECK(root->get_node_or_null(NodePath(child->get_name())) == child);
+
+	// A renamed child may take back its own name.
+	Node *renamed = spawned[2];
+	const StringName own_name = renamed->get_name();
+	renamed->set_name("Spawn");
+	CHECK(renamed->get_name() == own_name);
+
+	memdelete(root);
+	Node::set_human_readable_collision_renaming(false);
+}
+
+} // namespace TestNode
+
+#endif // TEST_NODE_H
@@ -32,6 +32,7 @@
 #define TEST_OBJECT_H
 
 #include "core/core_string_names.h"
+#include "core/object/message_queue.h"
 #include "core/object/object.h"
 
 #include "thirdparty/doctest/doctest.h"
@@ -300,6 +301,32 @@ TEST_CASE("[Object] Absent name getter") {
 			actual_value == Variant(),
 			"The returned value should equal nil variant.");
 }
+
+TEST_CASE("[Object] Signals are deferred to the thread message queue") {
+	MessageQueue thread_queue(64 * 1024);
+	MessageQueue main_queue(64 * 1024);
+
+	Object emitter;
+	Object target;
+	Vector<Variant> binds;
+	binds.push_back("signalled");
+	binds.push_back(true);
+	emitter.connect("script_changed", Callable(&target, "set_meta"), binds);
+
+	MessageQueue::set_thread_singleton(&thread_queue);
+	emitter.emit_signal("script_changed");
+	MessageQueue::get_singleton()->push_call(&target, "set_meta", "called", 1);
+	MessageQueue::set_thread_singleton(nullptr);
+
+	CHECK_MESSAGE(!target.has_meta("signalled"), "The signal should be deferred while a thread message queue is set.");
+
+	thread_queue.transfer_to(&main_queue);
+	CHECK_MESSAGE(!target.has_meta("signalled"), "Transferring messages should not run them.");
+
+	main_queue.flush();
+	CHECK_MESSAGE(bool(target.get_meta("signalled")), "The deferred signal should run when the queue it was moved to is flushed.");
+	CHECK_MESSAGE(int(target.get_meta("called")) == 1, "The deferred call should run when the queue it was moved to is flushed.");
+}
 } // namespace TestObject
 
 #endif // TEST_OBJECT_H
@@ -0,0 +1,124 @@
+/*************************************************************************/
+/*  test_packed_scene.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PACKED_SCENE_H
+#define TEST_PACKED_SCENE_H
+
+#include "core/os/thread.h"
+#include "scene/main/timer.h"
+#include "scene/resources/packed_scene.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPackedScene {
+
+static Ref<PackedScene> create_timers_scene(int p_count) {
+	Node *root = memnew(Node);
+	root->set_name("Root");
+
+	for (int i = 0; i < p_count; i++) {
+		Timer *timer = memnew(Timer);
+		timer->set_name("Timer" + itos(i));
+		timer->set_wait_time(i + 1);
+		timer->set_one_shot(i % 2);
+		timer->add_to_group("timers", true);
+		root->add_child(timer);
+		timer->set_owner(root);
+	}
+
+	Ref<PackedScene> scene;
+	scene.instance();
+	CHECK(scene->pack(root) == OK);
+	memdelete(root);
+	return scene;
+}
+
+static bool check_timers_instance(Node *p_root, int p_count) {
+	if (!p_root || p_root->get_child_count() != p_count) {
+		return false;
+	}
+	for (int i = 0; i < p_count; i++) {
+		Timer *timer = Object::cast_to<Timer>(p_root->get_child(i));
+		if (!timer || timer->get_name() != "Timer" + itos(i) || timer->get_owner() != p_root) {
+			return false;
+		}
+		if (timer->get_wait_time() != i + 1 || timer->is_one_shot() != bool(i % 2) || !timer->is_in_group("timers")) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("[PackedScene] Instance a packed scene") {
+	Ref<PackedScene> scene = create_timers_scene(10);
+
+	// The second time uses the plan built by the first one.
+	for (int i = 0; i < 2; i++) {
+		Node *instance = scene->instance();
+		CHECK_MESSAGE(check_timers_instance(instance, 10), "The instance should have the packed nodes and properties.");
+		memdelete(instance);
+	}
+}
+
+struct InstanceThreadData {
+	Ref<PackedScene> scene;
+	Node *instances[16] = {};
+};
+
+static void instance_thread(void *p_userdata) {
+	InstanceThreadData *data = (InstanceThreadData *)p_userdata;
+	for (int i = 0; i < 16; i++) {
+		data->instances[i] = data->scene->instance();
+	}
+}
+
+TEST_CASE("[PackedScene] Instance a packed scene from several threads") {
+	Ref<PackedScene> scene = create_timers_scene(50);
+
+	InstanceThreadData data[4];
+	Thread threads[4];
+	for (int i = 0; i < 4; i++) {
+		data[i].scene = scene;
+		threads[i].start(instance_thread, &data[i]);
+	}
+
+	for (int i = 0; i < 4; i++) {
+		threads[i].wait_to_finish();
+		for (int j = 0; j < 16; j++) {
+			CHECK_MESSAGE(check_timers_instance(data[i].instances[j], 50), "Instances built on other threads should be complete.");
+			if (data[i].instances[j]) {
+				memdelete(data[i].instances[j]);
+			}
+		}
+	}
+}
+} // namespace TestPackedScene
+
+#endif // TEST_PACKED_SCENE_H
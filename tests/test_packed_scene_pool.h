@@ -0,0 +1,145 @@
+/*************************************************************************/
+/*  test_packed_scene_pool.h                                             */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PACKED_SCENE_POOL_H
+#define TEST_PACKED_SCENE_POOL_H
+
+#include "scene/main/timer.h"
+#include "scene/resources/packed_scene_pool.h"
+
+#include "tests/test_macros.h"
+
+// Declared in global namespace because of GDCLASS macro warning (Windows):
+// "Unqualified friend declaration referring to type outside of the nearest enclosing namespace
+// is a Microsoft extension; add a nested name specifier".
+class _TestPoolArrayNode : public Node {
+	GDCLASS(_TestPoolArrayNode, Node);
+
+	Array values;
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_values", "values"), &_TestPoolArrayNode::set_values);
+		ClassDB::bind_method(D_METHOD("get_values"), &_TestPoolArrayNode::get_values);
+		ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "values"), "set_values", "get_values");
+	}
+
+public:
+	void set_values(const Array &p_values) { values = p_values; }
+	Array get_values() const { return values; }
+};
+
+namespace TestPackedScenePool {
+
+static Ref<PackedScene> create_timer_scene() {
+	Node *root = memnew(Node);
+	Timer *timer = memnew(Timer);
+	timer->set_name("Timer");
+	timer->set_wait_time(2);
+	root->add_child(timer);
+	timer->set_owner(root);
+
+	Ref<PackedScene> scene;
+	scene.instance();
+	CHECK(scene->pack(root) == OK);
+	memdelete(root);
+	return scene;
+}
+
+TEST_CASE("[PackedScenePool] Acquire and release instances") {
+	Ref<PackedScenePool> pool;
+	pool.instance();
+	pool->set_scene(create_timer_scene());
+	pool->warm_up(2);
+	CHECK(pool->get_available_count() == 2);
+
+	Node *first = pool->acquire();
+	Node *second = pool->acquire();
+	REQUIRE(first);
+	REQUIRE(second);
+	CHECK(first != second);
+	CHECK(pool->get_hit_count() == 2);
+	CHECK(pool->get_miss_count() == 0);
+
+	Node *third = pool->acquire();
+	REQUIRE(third);
+	CHECK_MESSAGE(pool->get_miss_count() == 1, "Acquiring from an empty pool should instance the scene.");
+
+	Object::cast_to<Timer>(first->get_node(NodePath("Timer")))->set_wait_time(5);
+	pool->release(first);
+	CHECK(pool->get_available_count() == 1);
+
+	Node *reused = pool->acquire();
+	CHECK_MESSAGE(reused == first, "Released instances should be reused.");
+	CHECK_MESSAGE(
+			Object::cast_to<Timer>(reused->get_node(NodePath("Timer")))->get_wait_time() == doctest::Approx(2),
+			"Released instances should be reset to the scene's values.");
+
+	pool->set_max_size(1);
+	pool->release(reused);
+	pool->release(second);
+	CHECK_MESSAGE(pool->get_available_count() == 1, "Instances released beyond the maximum size should be freed.");
+
+	memdelete(third);
+}
+
+TEST_CASE("[PackedScenePool] Arrays modified in place are reset") {
+	ClassDB::register_class<_TestPoolArrayNode>();
+
+	_TestPoolArrayNode *root = memnew(_TestPoolArrayNode);
+	Array values;
+	values.push_back(1);
+	values.push_back(2);
+	root->set_values(values);
+
+	Ref<PackedScene> scene;
+	scene.instance();
+	CHECK(scene->pack(root) == OK);
+	memdelete(root);
+
+	Ref<PackedScenePool> pool;
+	pool.instance();
+	pool->set_scene(scene);
+
+	_TestPoolArrayNode *instance = Object::cast_to<_TestPoolArrayNode>(pool->acquire());
+	REQUIRE(instance);
+	// The first instance is the one the defaults are recorded from.
+	instance->get_values().push_back(3);
+	pool->release(instance);
+
+	instance = Object::cast_to<_TestPoolArrayNode>(pool->acquire());
+	REQUIRE(instance);
+	CHECK_MESSAGE(instance->get_values().size() == 2, "Changes made in place to the first instance should not be kept.");
+
+	memdelete(instance);
+}
+} // namespace TestPackedScenePool
+
+#endif // TEST_PACKED_SCENE_POOL_H
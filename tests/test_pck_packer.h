@@ -31,8 +31,11 @@
 #ifndef TEST_PCK_PACKER_H
 #define TEST_PCK_PACKER_H
 
+#include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/file_access_pack.h"
 #include "core/io/pck_packer.h"
+#include "core/os/dir_access.h"
 #include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
@@ -109,6 +112,170 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_len() <= 35000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Read back a compressed file") {
+	Vector<uint8_t> data;
+	data.resize(PACK_COMPRESSED_BLOCK_SIZE * 20 + 123);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = (i * 7) % 251;
+	}
+
+	Vector<uint8_t> compressed = PackedData::compress_file(data);
+	REQUIRE_MESSAGE(
+			!compressed.is_empty(),
+			"Data that compresses well should be kept compressed.");
+	CHECK_MESSAGE(
+			compressed.size() < data.size() / 2,
+			"The compressed file should be much smaller than the original.");
+
+	FileAccessMemory *fm = memnew(FileAccessMemory);
+	fm->open_custom(compressed.ptr(), compressed.size());
+	fm->seek(4); // Skip the magic, as done when opening packed files.
+
+	FileAccessCompressed fac;
+	fac.configure(PACK_COMPRESSED_MAGIC, Compression::MODE_ZSTD, PACK_COMPRESSED_BLOCK_SIZE);
+	REQUIRE(fac.open_after_magic(fm) == OK);
+	CHECK(fac.get_len() == (size_t)data.size());
+
+	Vector<uint8_t> out;
+	out.resize(data.size());
+
+	fac.seek(PACK_COMPRESSED_BLOCK_SIZE * 3 - 10);
+	CHECK_MESSAGE(
+			fac.get_buffer(out.ptrw(), 20) == 20,
+			"Reading across two blocks should return all the requested bytes.");
+	bool matches = true;
+	for (int i = 0; i < 20; i++) {
+		matches = matches && out[i] == data[PACK_COMPRESSED_BLOCK_SIZE * 3 - 10 + i];
+	}
+	CHECK_MESSAGE(matches, "Reading across two blocks should return the original bytes.");
+
+	fac.seek(0);
+	CHECK_MESSAGE(
+			fac.get_buffer(out.ptrw(), data.size()) == data.size(),
+			"Reading the whole file at once should return all of it.");
+	CHECK_MESSAGE(out == data, "Reading the whole file at once should return the original bytes.");
+	CHECK(!fac.eof_reached());
+
+	uint8_t extra;
+	CHECK(fac.get_buffer(&extra, 1) == 0);
+	CHECK(fac.eof_reached());
+}
+
+TEST_CASE("[PCKPacker] Don't compress files that don't compress well") {
+	Vector<uint8_t> data;
+	data.resize(4096);
+	uint32_t seed = 1234;
+	for (int i = 0; i < data.size(); i++) {
+		seed = seed * 1103515245 + 12345;
+		data.write[i] = seed >> 24;
+	}
+
+	CHECK_MESSAGE(
+			PackedData::compress_file(data).is_empty(),
+			"Random data should be stored uncompressed.");
+}
+
+TEST_CASE("[PCKPacker] Rebuild a file from a delta") {
+	Vector<uint8_t> base;
+	base.resize(PACK_DELTA_BLOCK_SIZE * 16);
+	uint32_t seed = 1234;
+	for (int i = 0; i < base.size(); i++) {
+		seed = seed * 1103515245 + 12345;
+		base.write[i] = seed >> 24;
+	}
+	uint8_t base_md5[16] = {};
+
+	// Insert some bytes in the middle and change the end, so most blocks move.
+	Vector<uint8_t> data = base;
+	for (int i = 0; i < 100; i++) {
+		data.insert(PACK_DELTA_BLOCK_SIZE * 5 + 10, i);
+	}
+	data.resize(data.size() - 1000);
+	data.push_back(42);
+
+	Vector<uint8_t> delta = PackedData::make_delta(base, base_md5, data);
+	CHECK_MESSAGE(
+			delta.size() < data.size() / 4,
+			"Blocks of the base that moved should be found and not stored again.");
+
+	Vector<uint8_t> out;
+	REQUIRE(PackedData::apply_delta(delta, base, out) == OK);
+	CHECK_MESSAGE(out == data, "The rebuilt file should match the original bytes.");
+}
+
+static void _store_file(const String &p_path, const Vector<uint8_t> &p_data) {
+	FileAccessRef f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f);
+	f->store_buffer(p_data.ptr(), p_data.size());
+	f->close();
+}
+
+TEST_CASE("[PCKPacker] Read back a delta file from a patch pack") {
+	const String cache_path = OS::get_singleton()->get_cache_path();
+	const String base_src_path = cache_path.plus_file("delta_base.bin");
+	const String patch_src_path = cache_path.plus_file("delta_patch.bin");
+	const String base_pck_path = cache_path.plus_file("output_delta_base.pck");
+	const String patch_pck_path = cache_path.plus_file("output_delta_patch.pck");
+
+	Vector<uint8_t> base;
+	base.resize(PACK_DELTA_BLOCK_SIZE * 16);
+	uint32_t seed = 4321;
+	for (int i = 0; i < base.size(); i++) {
+		seed = seed * 1103515245 + 12345;
+		base.write[i] = seed >> 24;
+	}
+	Vector<uint8_t> data = base;
+	for (int i = 0; i < 64; i++) {
+		data.insert(PACK_DELTA_BLOCK_SIZE * 7 + 3, i);
+	}
+	_store_file(base_src_path, base);
+	_store_file(patch_src_path, data);
+
+	PCKPacker base_packer;
+	REQUIRE(base_packer.pck_start(base_pck_path) == OK);
+	REQUIRE(base_packer.add_file("res://delta.bin", base_src_path) == OK);
+	REQUIRE(base_packer.flush() == OK);
+
+	PCKPacker patch_packer;
+	REQUIRE(patch_packer.pck_start(patch_pck_path) == OK);
+	REQUIRE(patch_packer.set_patch_base(base_pck_path) == OK);
+	REQUIRE(patch_packer.add_file("res://delta.bin", patch_src_path) == OK);
+	REQUIRE(patch_packer.flush() == OK);
+
+	{
+		FileAccessRef f = FileAccess::open(patch_pck_path, FileAccess::READ);
+		REQUIRE(f);
+		CHECK_MESSAGE(
+				f->get_len() < (size_t)data.size() / 4,
+				"The patch pack should only hold the bytes that changed.");
+	}
+
+	{
+		// The base has to be loaded first, the delta is rebuilt from it when opened.
+		PackedData packed_data;
+		REQUIRE(packed_data.add_pack(base_pck_path, true, 0) == OK);
+		REQUIRE(packed_data.add_pack(patch_pck_path, true, 0) == OK);
+
+		FileAccess *f = packed_data.try_open_path("res://delta.bin");
+		REQUIRE(f);
+		CHECK(f->get_len() == (size_t)data.size());
+
+		Vector<uint8_t> out;
+		out.resize(data.size());
+		CHECK(f->get_buffer(out.ptrw(), out.size()) == out.size());
+		CHECK_MESSAGE(out == data, "The file read from the patch pack should match the new version.");
+
+		f->seek(PACK_DELTA_BLOCK_SIZE * 7);
+		CHECK(f->get_8() == data[PACK_DELTA_BLOCK_SIZE * 7]);
+		memdelete(f);
+	}
+
+	DirAccess::remove_file_or_error(base_src_path);
+	DirAccess::remove_file_or_error(patch_src_path);
+	DirAccess::remove_file_or_error(base_pck_path);
+	DirAccess::remove_file_or_error(patch_pck_path);
+}
 } // namespace TestPCKPacker
 
 #endif // TEST_PCK_PACKER_H
@@ -0,0 +1,208 @@
+/*************************************************************************/
+/*  test_scene_tree_process_list.h                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_SCENE_TREE_PROCESS_LIST_H
+#define TEST_SCENE_TREE_PROCESS_LIST_H
+
+#include "scene/main/scene_tree.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSceneTreeProcessList {
+
+// Plays the part of a node: `order` stands for its position in the tree.
+struct TestItem {
+	int id = 0;
+	int priority = 0;
+	int order = 0;
+	int index = -1;
+
+	TestItem(int p_id, int p_priority, int p_order) {
+		id = p_id;
+		priority = p_priority;
+		order = p_order;
+	}
+};
+
+struct TestAccessor {
+	int get_priority(const TestItem *p_item) const { return p_item->priority; }
+	int &get_index(TestItem *p_item) const { return p_item->index; }
+	bool less(const TestItem *p_a, const TestItem *p_b) const { return p_a->order < p_b->order; }
+};
+
+typedef SceneTreeProcessList<TestItem, TestAccessor> TestProcessList;
+
+// Iterates like SceneTree does for a frame, calling p_on_visit for each item, and returns the ids in visit order.
+template <class F>
+static Vector<int> process(TestProcessList &p_list, F p_on_visit) {
+	Vector<int> visited;
+	p_list.begin_iteration();
+	for (uint32_t i = 0; i < p_list.get_bucket_count(); i++) {
+		for (uint32_t j = 0; j < p_list.get_bucket_size(i); j++) {
+			TestItem *item = p_list.get_item(i, j);
+			if (!item) {
+				continue; // Removed while iterating.
+			}
+			visited.push_back(item->id);
+			p_on_visit(item);
+		}
+	}
+	p_list.end_iteration();
+	return visited;
+}
+
+static Vector<int> process(TestProcessList &p_list) {
+	return process(p_list, [](TestItem *) {});
+}
+
+static Vector<int> ids(std::initializer_list<int> p_ids) {
+	Vector<int> result;
+	for (int id : p_ids) {
+		result.push_back(id);
+	}
+	return result;
+}
+
+TEST_CASE("[SceneTreeProcessList] Items are visited by priority, then in order") {
+	TestProcessList list;
+	TestItem a(0, 0, 2);
+	TestItem b(1, 0, 1);
+	TestItem c(2, -1, 5);
+	TestItem d(3, 1, 0);
+	list.add(&a);
+	list.add(&b);
+	list.add(&c);
+	list.add(&d);
+
+	CHECK(process(list) == ids({ 2, 1, 0, 3 }));
+
+	// Moving an item in the tree sorts its bucket again.
+	a.order = 0;
+	list.order_changed(&a);
+	CHECK(process(list) == ids({ 2, 0, 1, 3 }));
+}
+
+TEST_CASE("[SceneTreeProcessList] Removing items while iterating") {
+	TestProcessList list;
+	TestItem a(0, 0, 0);
+	TestItem b(1, 0, 1);
+	TestItem c(2, 0, 2);
+	TestItem d(3, 0, 3);
+	list.add(&a);
+	list.add(&b);
+	list.add(&c);
+	list.add(&d);
+
+	// The item being visited removes itself and one that wasn't visited yet.
+	Vector<int> visited = process(list, [&](TestItem *p_item) {
+		if (p_item == &b) {
+			list.remove(&b);
+			list.remove(&c);
+		}
+	});
+	CHECK(visited == ids({ 0, 1, 3 }));
+	CHECK(b.index == TestProcessList::INDEX_NONE);
+	CHECK(c.index == TestProcessList::INDEX_NONE);
+
+	CHECK(process(list) == ids({ 0, 3 }));
+	CHECK(a.index == 0);
+	CHECK(d.index == 1);
+
+	list.remove(&a);
+	list.remove(&d);
+	CHECK(process(list).is_empty());
+}
+
+TEST_CASE("[SceneTreeProcessList] Items added while iterating wait for the next iteration") {
+	TestProcessList list;
+	TestItem a(0, 0, 0);
+	TestItem b(1, 0, 2);
+	TestItem added(2, 0, 1);
+	TestItem removed(3, 0, 3);
+	list.add(&a);
+	list.add(&b);
+
+	Vector<int> visited = process(list, [&](TestItem *p_item) {
+		if (p_item == &a) {
+			list.add(&added);
+			list.add(&removed);
+			CHECK(added.index == TestProcessList::INDEX_PENDING);
+			list.remove(&removed);
+		}
+	});
+	CHECK(visited == ids({ 0, 1 }));
+	CHECK(added.index >= 0);
+	CHECK(removed.index == TestProcessList::INDEX_NONE);
+
+	// Added out of order, so it's sorted into place.
+	CHECK(process(list) == ids({ 0, 2, 1 }));
+}
+
+TEST_CASE("[SceneTreeProcessList] Changing the priority of a queued item") {
+	TestProcessList list;
+	TestItem a(0, 0, 0);
+	TestItem b(1, 0, 1);
+	TestItem c(2, 0, 2);
+	list.add(&a);
+	list.add(&b);
+	list.add(&c);
+
+	// Like Node::set_process_priority(): removed with the old priority, added with the new one.
+	list.remove(&c);
+	c.priority = -1;
+	list.add(&c);
+	CHECK(process(list) == ids({ 2, 0, 1 }));
+
+	// Changed while iterating, after it was visited: not visited again in the same iteration.
+	Vector<int> visited = process(list, [&](TestItem *p_item) {
+		if (p_item == &b) {
+			list.remove(&c);
+			c.priority = 1;
+			list.add(&c);
+		}
+	});
+	CHECK(visited == ids({ 2, 0, 1 }));
+	CHECK(process(list) == ids({ 0, 1, 2 }));
+
+	// Changed while iterating, before it was visited: it waits for the next iteration.
+	visited = process(list, [&](TestItem *p_item) {
+		if (p_item == &a) {
+			list.remove(&c);
+			c.priority = -1;
+			list.add(&c);
+		}
+	});
+	CHECK(visited == ids({ 0, 1 }));
+	CHECK(process(list) == ids({ 2, 0, 1 }));
+}
+
+} // namespace TestSceneTreeProcessList
+
+#endif // TEST_SCENE_TREE_PROCESS_LIST_H
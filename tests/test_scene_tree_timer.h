@@ -0,0 +1,203 @@
+/*************************************************************************/
+/*  test_scene_tree_timer.h                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_SCENE_TREE_TIMER_H
+#define TEST_SCENE_TREE_TIMER_H
+
+#include "scene/main/scene_tree.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSceneTreeTimer {
+
+// Plays the part of Timer: counts its timeouts and may stop or restart itself from the callback.
+class TestTimer : public Object {
+public:
+	enum OnTimeout {
+		KEEP,
+		STOP,
+		RESTART,
+	};
+
+	SceneTreeTimerScheduler *scheduler = nullptr;
+	SceneTreeTimerHandle handle;
+	OnTimeout on_timeout = KEEP;
+	int timeouts = 0;
+
+	static void _timeout(Object *p_owner) {
+		TestTimer *timer = static_cast<TestTimer *>(p_owner);
+		timer->timeouts++;
+		if (timer->on_timeout == STOP) {
+			timer->scheduler->unschedule(&timer->handle);
+		} else if (timer->on_timeout == RESTART) {
+			timer->scheduler->schedule(&timer->handle, timer->handle.queue, 1.0);
+		}
+	}
+
+	TestTimer(SceneTreeTimerScheduler *p_scheduler, double p_repeat = 0.0) {
+		scheduler = p_scheduler;
+		handle.owner = this;
+		handle.timeout = &TestTimer::_timeout;
+		handle.repeat = p_repeat;
+	}
+};
+
+TEST_CASE("[SceneTreeTimer] One-shot and repeating timers") {
+	SceneTreeTimerScheduler scheduler(1);
+	TestTimer one_shot(&scheduler);
+	TestTimer repeating(&scheduler, 1.0);
+	scheduler.schedule(&one_shot.handle, 0, 1.0);
+	scheduler.schedule(&repeating.handle, 0, 1.0);
+
+	scheduler.process(0, 0.5);
+	CHECK(one_shot.timeouts == 0);
+	CHECK(repeating.timeouts == 0);
+	CHECK(scheduler.get_time_left(&one_shot.handle) == doctest::Approx(0.5));
+
+	scheduler.process(0, 0.6);
+	CHECK(one_shot.timeouts == 1);
+	CHECK(repeating.timeouts == 1);
+	CHECK_FALSE(one_shot.handle.is_scheduled());
+	CHECK(repeating.handle.is_scheduled());
+	CHECK(scheduler.get_time_left(&repeating.handle) == doctest::Approx(0.9));
+
+	scheduler.process(0, 1.0);
+	CHECK(one_shot.timeouts == 1);
+	CHECK(repeating.timeouts == 2);
+	CHECK(scheduler.get_time_left(&repeating.handle) == doctest::Approx(0.9));
+}
+
+TEST_CASE("[SceneTreeTimer] A lagging repeating timer times out once per frame") {
+	SceneTreeTimerScheduler scheduler(1);
+	TestTimer repeating(&scheduler, 1.0);
+	scheduler.schedule(&repeating.handle, 0, 1.0);
+
+	// Three periods late, the missed timeouts are caught up on the next frames.
+	scheduler.process(0, 3.5);
+	CHECK(repeating.timeouts == 1);
+	scheduler.process(0, 0.0);
+	CHECK(repeating.timeouts == 2);
+	scheduler.process(0, 0.0);
+	CHECK(repeating.timeouts == 3);
+	scheduler.process(0, 0.0);
+	CHECK(repeating.timeouts == 3);
+	CHECK(scheduler.get_time_left(&repeating.handle) == doctest::Approx(0.5));
+}
+
+TEST_CASE("[SceneTreeTimer] Pausing keeps the time left") {
+	SceneTreeTimerScheduler scheduler(1);
+	TestTimer timer(&scheduler);
+	scheduler.schedule(&timer.handle, 0, 2.0);
+	scheduler.process(0, 0.5);
+
+	// Timer leaves the queue while paused and comes back with the time it had left.
+	double time_left = scheduler.unschedule(&timer.handle);
+	CHECK(time_left == doctest::Approx(1.5));
+	CHECK_FALSE(timer.handle.is_scheduled());
+	CHECK(scheduler.unschedule(&timer.handle) == 0.0);
+
+	scheduler.process(0, 10.0);
+	CHECK(timer.timeouts == 0);
+
+	scheduler.schedule(&timer.handle, 0, time_left);
+	CHECK(scheduler.get_time_left(&timer.handle) == doctest::Approx(1.5));
+	scheduler.process(0, 1.0);
+	CHECK(timer.timeouts == 0);
+	scheduler.process(0, 0.6);
+	CHECK(timer.timeouts == 1);
+}
+
+TEST_CASE("[SceneTreeTimer] Moving a timer to another queue") {
+	// Like SceneTree::TIMER_QUEUE_SCENE_TREE and TIMER_QUEUE_SCENE_TREE_PAUSABLE.
+	const uint32_t always = 0;
+	const uint32_t pausable = 1;
+	SceneTreeTimerScheduler scheduler(2);
+	scheduler.process(always, 5.0);
+
+	TestTimer timer(&scheduler);
+	scheduler.schedule(&timer.handle, pausable, 1.0);
+
+	// While paused only the other queue is processed.
+	scheduler.process(always, 2.0);
+	CHECK(timer.timeouts == 0);
+
+	scheduler.move(&timer.handle, always);
+	CHECK(timer.handle.queue == always);
+	CHECK(scheduler.get_time_left(&timer.handle) == doctest::Approx(1.0));
+	scheduler.process(always, 1.1);
+	CHECK(timer.timeouts == 1);
+
+	// A repeating timer goes back to its own queue after timing out.
+	TestTimer repeating(&scheduler, 1.0);
+	scheduler.schedule(&repeating.handle, always, 0.5);
+	scheduler.move(&repeating.handle, pausable);
+	scheduler.process(pausable, 0.6);
+	CHECK(repeating.timeouts == 1);
+	CHECK(repeating.handle.queue == pausable);
+	scheduler.process(always, 10.0);
+	CHECK(repeating.timeouts == 1);
+	scheduler.process(pausable, 1.0);
+	CHECK(repeating.timeouts == 2);
+
+	// Moving a timer that is not scheduled only picks its queue.
+	scheduler.unschedule(&repeating.handle);
+	scheduler.move(&repeating.handle, always);
+	CHECK_FALSE(repeating.handle.is_scheduled());
+	CHECK(repeating.handle.queue == always);
+}
+
+TEST_CASE("[SceneTreeTimer] Stop and restart from the timeout callback") {
+	SceneTreeTimerScheduler scheduler(1);
+
+	TestTimer stopped(&scheduler, 1.0);
+	stopped.on_timeout = TestTimer::STOP;
+	scheduler.schedule(&stopped.handle, 0, 1.0);
+	scheduler.process(0, 3.5);
+	CHECK(stopped.timeouts == 1);
+	CHECK_FALSE(stopped.handle.is_scheduled());
+	scheduler.process(0, 1.0);
+	CHECK(stopped.timeouts == 1);
+
+	// A restart replaces the repeat that was already scheduled.
+	TestTimer restarted(&scheduler, 0.25);
+	restarted.on_timeout = TestTimer::RESTART;
+	scheduler.schedule(&restarted.handle, 0, 1.0);
+	scheduler.process(0, 1.5);
+	CHECK(restarted.timeouts == 1);
+	CHECK(scheduler.get_time_left(&restarted.handle) == doctest::Approx(1.0));
+	scheduler.process(0, 0.5);
+	CHECK(restarted.timeouts == 1);
+	scheduler.process(0, 0.6);
+	CHECK(restarted.timeouts == 2);
+}
+
+} // namespace TestSceneTreeTimer
+
+#endif // TEST_SCENE_TREE_TIMER_H
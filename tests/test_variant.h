@@ -106,6 +106,27 @@ TEST_CASE("[Variant] Writer and parser float") {
 	CHECK_MESSAGE(b64_float_parsed == 340282001837565597733306976381245063168.0, "Should not overflow.");
 }
 
+TEST_CASE("[Variant] Parser packed arrays longer than the read-ahead buffer") {
+	String str = "PackedFloat32Array( ";
+	for (int i = 0; i < 1000; i++) {
+		str += (i > 0 ? ", " : "") + itos(i) + ".5";
+	}
+	str += " )";
+
+	VariantParser::StreamString ss;
+	ss.s = str;
+	String errs;
+	int line;
+	Variant parsed;
+	REQUIRE(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	REQUIRE(parsed.get_type() == Variant::PACKED_FLOAT32_ARRAY);
+
+	PackedFloat32Array array = parsed;
+	CHECK(array.size() == 1000);
+	CHECK(array[0] == 0.5);
+	CHECK(array[999] == 999.5);
+}
+
 TEST_CASE("[Variant] Assignment To Bool from Int,Float,String,Vec2,Vec2i,Vec3,Vec3i and Color") {
 	Variant int_v = 0;
 	Variant bool_v = true;
@@ -699,6 +720,55 @@ TEST_CASE("[Variant] Assignment To Color from Bool,Int,Float,String,Vec2,Vec2i,V
 	vec3i_v = col_v;
 	CHECK(vec3i_v.get_type() == Variant::COLOR);
 }
+
+TEST_CASE("[Variant] Bulk math on packed arrays") {
+	PackedFloat32Array a;
+	a.push_back(1.0);
+	a.push_back(-2.0);
+	a.push_back(4.0);
+	PackedFloat32Array b;
+	b.push_back(3.0);
+	b.push_back(2.0);
+	b.push_back(-1.0);
+	Variant a_v = a;
+
+	PackedFloat32Array added = a_v.call("add", b);
+	CHECK(added[0] == doctest::Approx(4.0));
+	CHECK(added[1] == doctest::Approx(0.0));
+	CHECK(added[2] == doctest::Approx(3.0));
+
+	PackedFloat32Array lerped = a_v.call("lerp", b, 0.5);
+	CHECK(lerped[0] == doctest::Approx(2.0));
+	CHECK(lerped[2] == doctest::Approx(1.5));
+
+	PackedFloat32Array clamped = a_v.call("clamp", -1.0, 1.0);
+	CHECK(clamped[1] == doctest::Approx(-1.0));
+	CHECK(clamped[2] == doctest::Approx(1.0));
+
+	CHECK(double(a_v.call("sum")) == doctest::Approx(3.0));
+	CHECK(double(a_v.call("min")) == doctest::Approx(-2.0));
+	CHECK(double(a_v.call("max")) == doctest::Approx(4.0));
+
+	PackedVector2Array v;
+	v.push_back(Vector2(3, 4));
+	v.push_back(Vector2(0, -2));
+	Variant v_v = v;
+
+	PackedFloat32Array lengths = v_v.call("lengths");
+	CHECK(lengths[0] == doctest::Approx(5.0));
+	CHECK(lengths[1] == doctest::Approx(2.0));
+
+	PackedFloat32Array dots = v_v.call("dot", v);
+	CHECK(dots[0] == doctest::Approx(25.0));
+	CHECK(dots[1] == doctest::Approx(4.0));
+
+	CHECK(Vector2(v_v.call("sum")).is_equal_approx(Vector2(3, 2)));
+
+	ERR_PRINT_OFF;
+	PackedFloat32Array mismatched = a_v.call("multiply", PackedFloat32Array());
+	ERR_PRINT_ON;
+	CHECK(mismatched.is_empty());
+}
 } // namespace TestVariant
 
 #endif // TEST_VARIANT_H